@@ -6,6 +6,36 @@
 #include <climits>
 #include <string>
 #include <limits>
+#include <tuple>
+#include <set>
+#include <functional>
+#include <deque>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CPU_SCHEDULER_HAVE_MMAP
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define CPU_SCHEDULER_X86_KERNELS
+#endif
 
 using namespace std;
 
@@ -14,8 +44,17 @@ struct ExecutionSegment {
     int processID;
     int startTime;
     int endTime;
+    int coreID; // Simulated core that ran the segment (0 for the single-core engines)
+
+    ExecutionSegment() : processID(0), startTime(0), endTime(0), coreID(0) {}
+    ExecutionSegment(int processID, int startTime, int endTime, int coreID = 0)
+        : processID(processID), startTime(startTime), endTime(endTime), coreID(coreID) {}
 };
 
+// One process with its results, the row type of the interactive menu and the reference
+// engines, which modify it in place. It is self-contained rather than a view over Workload
+// columns; the vector<Process> overloads of the event-driven engines copy the rows into a
+// Workload and store the results back (Workload::storeResults).
 class Process {
     private:
         int PID;
@@ -28,6 +67,10 @@ class Process {
         int completionTime;
         int turnaroundTime;
         int waitingTime;
+        int firstDispatchTime; // Time the process first got the CPU, -1 until then
+        int responseTime;      // First dispatch minus arrival
+        int preemptions;       // Times it lost the CPU with work left
+        int contextSwitches;   // Times the CPU switched to it
 
         Process(int PID, int arrivalTime, int burstTime, int priority) {
             this->PID = PID;
@@ -38,6 +81,10 @@ class Process {
             this->completionTime = 0;
             this->turnaroundTime = 0;
             this->waitingTime = 0;
+            this->firstDispatchTime = -1;
+            this->responseTime = 0;
+            this->preemptions = 0;
+            this->contextSwitches = 0;
         }
 
         // Getter methods (const - read-only, cannot modify object state)
@@ -63,354 +110,3039 @@ class Process {
         // Records the completion time when process finishes execution
         void setCompletionTime(int time) { completionTime = time; }
         
+        // Records that the CPU switches to this process at `time`
+        void recordDispatch(int time) {
+            if (firstDispatchTime < 0) firstDispatchTime = time;
+            contextSwitches++;
+        }
+
+        // Clears the dispatch counters before a new run
+        void resetRunStats() {
+            firstDispatchTime = -1;
+            preemptions = 0;
+            contextSwitches = 0;
+        }
+
         // Calculator methods - derive metrics from completion time and arrival time
         // Calculates turnaround time: how long from arrival to completion
         void calculateTurnaroundTime() { turnaroundTime = completionTime - arrivalTime; }
         
         // Calculates waiting time: total time waiting (turnaround - actual execution)
         void calculateWaitingTime() { waitingTime = turnaroundTime - burstTime; }
-};
-
-class Scheduler {
-public:
-    // FCFS - First Come First Served
-    static vector<ExecutionSegment> FCFS(vector<Process>& processes) {
-        vector<ExecutionSegment> execution;
-        
-        sort(processes.begin(), processes.end(),
-             [](const Process& a, const Process& b) {
-                 return a.getArrivalTime() < b.getArrivalTime();
-             });
 
-        int currentTime = 0;
-        for (auto& p : processes) {
-            if (currentTime < p.getArrivalTime()) {
-                currentTime = p.getArrivalTime();
-            }
-            int startTime = currentTime;
-            currentTime += p.getBurstTime();
-            p.setCompletionTime(currentTime);
-            p.calculateTurnaroundTime();
-            p.calculateWaitingTime();
-            
-            execution.push_back({p.getPID(), startTime, currentTime});
+        // Calculates response time: how long from arrival to first dispatch (a process that
+        // never got a segment counts as dispatched when it completed)
+        void calculateResponseTime() {
+            responseTime = (firstDispatchTime >= 0 ? firstDispatchTime : completionTime) - arrivalTime;
         }
-        
-        return execution;
-    }
-
-    // SJF - Shortest Job First (Non-preemptive)
-    // This algorithm selects the process with the shortest burst time that has arrived by the current time.
-    // It is non-preemptive, meaning once a process starts, it runs to completion.
-    static vector<ExecutionSegment> SJF(vector<Process>& processes) {
-        vector<ExecutionSegment> execution;
-        vector<bool> processed(processes.size(), false); // Track which processes have been completed
-        int currentTime = 0; // Current simulation time
-        int completed = 0; // Number of processes completed
+};
 
-        // Continue until all processes are completed
-        while (completed < processes.size()) {
-            int shortest = -1; // Index of the shortest job found
-            int shortestBurst = INT_MAX; // Burst time of the shortest job
+// Index of the highest set bit of a non-zero value (floor of log2)
+static inline int highestSetBit(unsigned int value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 31 - __builtin_clz(value);
+#else
+    int bit = 0;
+    while (value >>= 1) bit++;
+    return bit;
+#endif
+}
 
-            // Find the process with the smallest burst time that has arrived and not yet processed
-            for (int i = 0; i < processes.size(); i++) {
-                if (!processed[i] && processes[i].getArrivalTime() <= currentTime &&
-                    processes[i].getBurstTime() < shortestBurst) {
-                    shortest = i;
-                    shortestBurst = processes[i].getBurstTime();
-                }
-            }
+// Log-linear latency histogram in the style of HdrHistogram. Values below 2^SUB_BUCKET_BITS
+// get a bucket each, and every larger power of two is split into 2^(SUB_BUCKET_BITS-1) equal
+// buckets, so a reported percentile is within 1/128 of the true value. Memory stays fixed
+// (3200 counters) no matter how many values are recorded, and nothing is sorted.
+class LatencyHistogram {
+    public:
+        static const int SUB_BUCKET_BITS = 8;
 
-            // If no process has arrived yet, advance time to the next arrival time
-            if (shortest == -1) {
-                for (int i = 0; i < processes.size(); i++) {
-                    if (!processed[i]) {
-                        currentTime = processes[i].getArrivalTime();
-                        shortest = i;
-                        break;
-                    }
-                }
-            }
+    private:
+        static const int HALF_SUB_BUCKETS = 1 << (SUB_BUCKET_BITS - 1);
+        vector<long long> counts;
+        long long total;
+        long long sum; // Of the recorded values, for an exact mean
+        int minValue;
+        int maxValue;
 
-            // Execute the selected process
-            processed[shortest] = true;
-            int startTime = currentTime;
-            currentTime += processes[shortest].getBurstTime();
-            processes[shortest].setCompletionTime(currentTime);
-            processes[shortest].calculateTurnaroundTime();
-            processes[shortest].calculateWaitingTime();
-            
-            execution.push_back({processes[shortest].getPID(), startTime, currentTime});
-            completed++;
+        static int bucketOf(int value) {
+            if (value < (1 << SUB_BUCKET_BITS)) return value;
+            int shift = highestSetBit(value) - SUB_BUCKET_BITS + 1;
+            return shift * HALF_SUB_BUCKETS + (value >> shift);
         }
-        
-        return execution;
-    }
 
-    // Round Robin
-    // This preemptive algorithm uses a time quantum. Each process gets a fixed time slice (quantum).
-    // If a process doesn't finish in its quantum, it's preempted and placed back in the queue.
-    // Processes are enqueued in arrival order initially.
-    static vector<ExecutionSegment> RoundRobin(vector<Process>& processes, int timeQuantum) {
-        vector<ExecutionSegment> execution;
-        queue<int> q; // Queue to hold process indices
-        vector<int> remainingTime(processes.size()); // Remaining burst time for each process
-        
-        // Initialize remaining times
-        for (int i = 0; i < processes.size(); i++) {
-            remainingTime[i] = processes[i].getBurstTime();
+        // Largest value that falls in `bucket`
+        static long long bucketHigh(int bucket) {
+            if (bucket < (1 << SUB_BUCKET_BITS)) return bucket;
+            int shift = bucket / HALF_SUB_BUCKETS - 1;
+            long long subBucket = bucket - shift * HALF_SUB_BUCKETS;
+            return ((subBucket + 1) << shift) - 1;
         }
 
-        // Sort processes by arrival time to enqueue them in order
-        sort(processes.begin(), processes.end(),
-             [](const Process& a, const Process& b) {
-                 return a.getArrivalTime() < b.getArrivalTime();
-             });
+    public:
+        LatencyHistogram() : counts(bucketOf(INT_MAX) + 1, 0), total(0), sum(0), minValue(0), maxValue(0) {}
 
-        // Enqueue all processes initially (assuming they arrive at time 0 or later, but queue handles order)
-        for (int i = 0; i < processes.size(); i++) {
-            q.push(i);
+        // Negative values (not produced by a valid schedule) are recorded as 0
+        void record(int value) {
+            if (value < 0) value = 0;
+            counts[bucketOf(value)]++;
+            minValue = total ? min(minValue, value) : value;
+            maxValue = total ? max(maxValue, value) : value;
+            total++;
+            sum += value;
         }
 
-        int currentTime = 0;
-        // Process the queue until empty
-        while (!q.empty()) {
-            int idx = q.front();
-            q.pop();
+        void merge(const LatencyHistogram& other) {
+            if (!other.total) return;
+            for (size_t b = 0; b < counts.size(); b++) counts[b] += other.counts[b];
+            minValue = total ? min(minValue, other.minValue) : other.minValue;
+            maxValue = total ? max(maxValue, other.maxValue) : other.maxValue;
+            total += other.total;
+            sum += other.sum;
+        }
 
-            int startTime = currentTime;
-            // If remaining time > quantum, execute for quantum and requeue
-            if (remainingTime[idx] > timeQuantum) {
-                currentTime += timeQuantum;
-                remainingTime[idx] -= timeQuantum;
-                execution.push_back({processes[idx].getPID(), startTime, currentTime});
-                q.push(idx); // Requeue the process
-            } else {
-                // Execute for remaining time and complete the process
-                currentTime += remainingTime[idx];
-                remainingTime[idx] = 0;
-                processes[idx].setCompletionTime(currentTime);
-                processes[idx].calculateTurnaroundTime();
-                processes[idx].calculateWaitingTime();
-                execution.push_back({processes[idx].getPID(), startTime, currentTime});
+        long long count() const { return total; }
+        double mean() const { return total ? sum / (double)total : 0; }
+        int lowest() const { return minValue; }
+        int highest() const { return maxValue; }
+
+        // Smallest recorded value v (up to bucket precision) such that `percent`% of the
+        // recorded values are <= v
+        int percentile(double percent) const {
+            if (!total) return 0;
+            long long target = (long long)ceil(percent / 100.0 * total);
+            if (target < 1) target = 1;
+            long long seen = 0;
+            for (size_t b = 0; b < counts.size(); b++) {
+                seen += counts[b];
+                if (seen >= target) return (int)min(bucketHigh(b), (long long)maxValue);
             }
+            return maxValue;
         }
-        
-        return execution;
-    }
+};
 
-    // Priority Scheduling (Non-preemptive) - Lower priority number = higher priority
-    // This algorithm selects the process with the highest priority (lowest number) that has arrived.
-    // If withAging is true, priorities improve over time to prevent starvation.
-    // Aging reduces priority by 1 every 'agingInterval' time units waited.
-    // Tie-breaking: earlier arrival time, then smaller burst time.
-    static vector<ExecutionSegment> PriorityScheduling(vector<Process>& processes, bool withAging = true) {
-        vector<ExecutionSegment> execution;
-        vector<bool> processed(processes.size(), false); // Track completed processes
-        int currentTime = 0; // Current simulation time
-        int completed = 0; // Number of processes completed
-        // Aging parameters: every `agingInterval` time units a waiting process's
-        // numeric priority is reduced by 1 (improves its priority since lower
-        // number means higher priority). This prevents starvation of low-priority
-        // processes.
-        const int agingInterval = 5; // time units per priority improvement
+// Turnaround, waiting and response time distributions of one run
+struct CompletionMetrics {
+    LatencyHistogram turnaround;
+    LatencyHistogram waiting;
+    LatencyHistogram response;
+    int makespan; // Latest completion time
 
-        // Continue until all processes are completed
-        while (completed < processes.size()) {
-            int highest = -1; // Index of the highest priority process
-            int highestPriority = INT_MAX; // Effective priority of the selected process
+    CompletionMetrics() : makespan(0) {}
 
-            // Find the process with the highest priority (lowest effective priority number)
-            for (int i = 0; i < processes.size(); i++) {
-                if (processed[i]) continue; // Skip already processed
-                int at = processes[i].getArrivalTime();
-                if (at > currentTime) continue; // Not arrived yet
+    void merge(const CompletionMetrics& other) {
+        turnaround.merge(other.turnaround);
+        waiting.merge(other.waiting);
+        response.merge(other.response);
+        makespan = max(makespan, other.makespan);
+    }
 
-                // Compute effective priority with aging if enabled
-                int effectivePriority;
-                if (withAging) {
-                    int waitTime = currentTime - at; // Time spent waiting
-                    int priorityDrop = waitTime / agingInterval; // Integer division for aging steps
-                    effectivePriority = processes[i].getPriority() - priorityDrop;
-                    if (effectivePriority < 0) effectivePriority = 0; // Clamp to prevent negative
-                } else {
-                    effectivePriority = processes[i].getPriority(); // No aging
-                }
+    // Processes completed per unit time
+    double throughput() const { return makespan > 0 ? turnaround.count() / (double)makespan : 0; }
+};
 
-                // Select the process with the lowest effective priority value
-                if (effectivePriority < highestPriority) {
-                    highest = i;
-                    highestPriority = effectivePriority;
-                } else if (effectivePriority == highestPriority) {
-                    // Tie-breaker: earlier arrival wins
-                    if (at < processes[highest].getArrivalTime()) {
-                        highest = i;
-                    } else if (at == processes[highest].getArrivalTime() &&
-                               processes[i].getBurstTime() < processes[highest].getBurstTime()) {
-                        // If same arrival, smaller burst wins
-                        highest = i;
-                    }
-                }
-            }
+// Input columns of a workload, one row per process in the order they were added. The
+// loaders and the generator fill them; engines only read them, so one WorkloadInput can back
+// any number of concurrent runs (the sweep shares each loaded trace between its workers).
+struct WorkloadInput {
+    vector<int> pid;
+    vector<int> arrival;
+    vector<int> burst;
+    vector<int> priority;
 
-            // If no process is ready, advance time to the next arrival
-            if (highest == -1) {
-                int nextArrival = INT_MAX;
-                for (int i = 0; i < processes.size(); i++) {
-                    if (!processed[i]) nextArrival = min(nextArrival, processes[i].getArrivalTime());
-                }
-                currentTime = nextArrival;
-                continue; // Restart the loop with new time
-            }
+    int size() const { return pid.size(); }
 
-            // Execute the selected process to completion
-            processed[highest] = true;
-            int startTime = currentTime;
-            currentTime += processes[highest].getBurstTime();
-            processes[highest].setCompletionTime(currentTime);
-            processes[highest].calculateTurnaroundTime();
-            processes[highest].calculateWaitingTime();
+    void reserve(int n) {
+        pid.reserve(n);
+        arrival.reserve(n);
+        burst.reserve(n);
+        priority.reserve(n);
+    }
 
-            execution.push_back({processes[highest].getPID(), startTime, currentTime});
-            completed++;
-        }
-        
-        return execution;
+    void add(int processID, int arrivalTime, int burstTime, int processPriority) {
+        pid.push_back(processID);
+        arrival.push_back(arrivalTime);
+        burst.push_back(burstTime);
+        priority.push_back(processPriority);
     }
 };
 
-void displayResults(const vector<Process>& processes, const string& algorithmName) {
-    cout << "\n" << string(80, '=') << endl;
-    cout << "Algorithm: " << algorithmName << endl;
-    cout << string(80, '=') << endl;
-    cout << left << setw(8) << "PID" << setw(15) << "Arrival Time"
-         << setw(12) << "Burst Time" << setw(18) << "Completion Time"
-         << setw(15) << "Turnaround" << setw(12) << "Waiting" << endl;
-    cout << string(80, '-') << endl;
+// Columnar (struct-of-arrays) workload consumed by the event-driven engines in Scheduler.
+// Hot loops read only the columns they need (mostly arrival and burst) instead of whole
+// Process objects, and per-process metrics reduce over contiguous int arrays. Turnaround and
+// waiting time are derived from the columns. The input columns are read-only references into
+// a WorkloadInput; a Workload owns only the per-run columns, so a run over a shared input
+// costs 20 bytes per row. Not copyable, since the references would still point at the source.
+struct Workload {
+private:
+    WorkloadInput owned; // Backs the input columns of a workload built from vector<Process>
 
-    double avgTurnaround = 0, avgWaiting = 0, totalTime = 0;
-    // Calculate averages and find the total time (maximum completion time)
-    for (const auto& p : processes) {
-        cout << left << setw(8) << p.getPID()
-             << setw(15) << p.getArrivalTime()
-             << setw(12) << p.getBurstTime()
-             << setw(18) << p.completionTime
-             << setw(15) << p.turnaroundTime
-             << setw(12) << p.waitingTime << endl;
-        avgTurnaround += p.turnaroundTime;
-        avgWaiting += p.waitingTime;
-        
-        // Track the maximum completion time to calculate total execution time
-        if (p.completionTime > totalTime) {
-            totalTime = p.completionTime;
-        }
+    void allocateRunColumns() {
+        int n = size();
+        remaining = burst;
+        completion.assign(n, 0);
+        firstDispatch.assign(n, -1);
+        preemptions.assign(n, 0);
+        contextSwitches.assign(n, 0);
     }
 
-    avgTurnaround /= processes.size();
-    avgWaiting /= processes.size();
-    
-    // Throughput: number of processes completed per unit time (processes / total time)
-    double throughput = processes.size() / totalTime;
-
-    cout << string(80, '-') << endl;
-    cout << "Average Turnaround Time: " << fixed << setprecision(2) << avgTurnaround << endl;
-    cout << "Average Waiting Time: " << fixed << setprecision(2) << avgWaiting << endl;
-    cout << "Throughput: " << fixed << setprecision(2) << throughput << endl;
-}
+public:
+    const vector<int>& pid;
+    const vector<int>& arrival;
+    const vector<int>& burst;
+    const vector<int>& priority;
+    vector<int> remaining;  // Remaining CPU time, reset to the burst time by the engines
+    vector<int> completion; // Written by the engines
+    vector<int> firstDispatch;   // -1 until the row first gets the CPU
+    vector<int> preemptions;     // Times the row lost the CPU with work left
+    vector<int> contextSwitches; // Times the CPU switched to the row
+    CompletionMetrics* metrics; // Optional: updated by dispatch() and complete()
+    int onCPU; // Row that ran the last segment, -1 before the first one
 
-// Function to display Gantt Chart
-void displayGanttChart(const vector<ExecutionSegment>& execution) {
-    if (execution.empty()) return;
-    
-    cout << "\n" << string(80, '=') << endl;
-    cout << "GANTT CHART VISUALIZATION" << endl;
-    cout << string(80, '=') << endl;
-    
-    // Find the maximum time for scaling
-    int maxTime = 0;
-    for (const auto& seg : execution) {
-        maxTime = max(maxTime, seg.endTime);
+    // Runs over `input`, which must outlive the workload and not change while it is used
+    explicit Workload(const WorkloadInput& input)
+        : pid(input.pid), arrival(input.arrival), burst(input.burst), priority(input.priority),
+          metrics(nullptr), onCPU(-1) {
+        allocateRunColumns();
     }
-    
-    // Draw the timeline
-    cout << "\nTimeline:" << endl;
-    cout << "Time: ";
-    for (int i = 0; i <= maxTime; i += 2) {
-        cout << setw(3) << i;
+
+    // Copies the input columns of a vector<Process>
+    explicit Workload(const vector<Process>& processes)
+        : pid(owned.pid), arrival(owned.arrival), burst(owned.burst), priority(owned.priority),
+          metrics(nullptr), onCPU(-1) {
+        owned.reserve(processes.size());
+        for (const auto& p : processes) owned.add(p.getPID(), p.getArrivalTime(), p.getBurstTime(), p.getPriority());
+        allocateRunColumns();
     }
-    cout << endl;
-    
-    // Draw Gantt chart bars
-    cout << "      ";
-    for (int i = 0; i < maxTime; i++) {
-        cout << "-";
+
+    Workload(const Workload&) = delete;
+    Workload& operator=(const Workload&) = delete;
+
+    int size() const { return pid.size(); }
+
+    // Clears the per-run columns; every engine calls this first
+    void reset() {
+        remaining = burst;
+        fill(firstDispatch.begin(), firstDispatch.end(), -1);
+        fill(preemptions.begin(), preemptions.end(), 0);
+        fill(contextSwitches.begin(), contextSwitches.end(), 0);
+        onCPU = -1;
     }
-    cout << endl;
-    
-    // Display each process segment
-    for (const auto& seg : execution) {
-        cout << "P" << seg.processID << "   |";
-        
-        // Print spaces before the process
-        for (int i = 0; i < seg.startTime; i++) {
-            cout << " ";
-        }
-        
-        // Print the process block
-        int duration = seg.endTime - seg.startTime;
-        for (int i = 0; i < duration; i++) {
-            cout << "=";
+
+    // Records that row i runs a segment starting at `time` on the (single) CPU. Engines call
+    // this for every segment they emit, in time order. A segment of the row that ran last is
+    // a continuation; otherwise the previous row counts as preempted if it has work left.
+    void dispatch(int i, int time) {
+        if (i == onCPU) return;
+        if (onCPU >= 0 && remaining[onCPU] > 0) preemptions[onCPU]++;
+        onCPU = i;
+        contextSwitches[i]++;
+        if (firstDispatch[i] < 0) {
+            firstDispatch[i] = time;
+            if (metrics) metrics->response.record(time - arrival[i]);
         }
-        
-        // Print process duration label
-        cout << "(" << duration << ")";
-        cout << endl;
     }
-    
-    cout << "      ";
-    for (int i = 0; i < maxTime; i++) {
-        cout << "-";
+
+    // Records that row i finished at `time`
+    void complete(int i, int time) {
+        completion[i] = time;
+        remaining[i] = 0;
+        if (metrics) {
+            metrics->turnaround.record(time - arrival[i]);
+            metrics->waiting.record(time - arrival[i] - burst[i]);
+            metrics->makespan = max(metrics->makespan, time);
+        }
     }
-    cout << endl;
-    
-    // Display time markers
-    cout << "      ";
-    for (int i = 0; i <= maxTime; i++) {
-        if (i % 2 == 0) cout << i;
-        else cout << " ";
+
+    int turnaroundTime(int i) const { return completion[i] - arrival[i]; }
+    int waitingTime(int i) const { return completion[i] - arrival[i] - burst[i]; }
+    int responseTime(int i) const { return (firstDispatch[i] >= 0 ? firstDispatch[i] : completion[i]) - arrival[i]; }
+
+    // Writes the per-run columns back into the Process rows this workload was built from
+    // (same order) and recomputes their turnaround, waiting and response time
+    void storeResults(vector<Process>& processes) const {
+        for (int i = 0; i < size(); i++) {
+            processes[i].setRemainingTime(remaining[i]);
+            processes[i].setCompletionTime(completion[i]);
+            processes[i].firstDispatchTime = firstDispatch[i];
+            processes[i].preemptions = preemptions[i];
+            processes[i].contextSwitches = contextSwitches[i];
+            processes[i].calculateTurnaroundTime();
+            processes[i].calculateWaitingTime();
+            processes[i].calculateResponseTime();
+        }
     }
-    cout << endl;
-    
-    // Display process details
-    cout << "\nProcess Execution Details:" << endl;
-    cout << left << setw(10) << "Process" << setw(12) << "Start Time" << setw(12) << "End Time" << setw(12) << "Duration" << endl;
-    cout << string(46, '-') << endl;
-    
-    for (const auto& seg : execution) {
-        cout << left << setw(10) << "P" + to_string(seg.processID)
-             << setw(12) << seg.startTime
-             << setw(12) << seg.endTime
-             << setw(12) << (seg.endTime - seg.startTime) << endl;
+
+    // Materializes the rows as Process objects, results included
+    vector<Process> toProcesses() const {
+        vector<Process> processes;
+        processes.reserve(size());
+        for (int i = 0; i < size(); i++) processes.emplace_back(pid[i], arrival[i], burst[i], priority[i]);
+        storeResults(processes);
+        return processes;
     }
+};
+
+// Integer division rounding toward negative infinity (aging steps must not round up for
+// negative differences)
+static inline long long floorDiv(long long a, long long b) {
+    long long q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) q--;
+    return q;
 }
 
-// Function to execute the selected scheduling algorithm
-void executeScheduler(vector<Process>& processes, int choice) {
-    vector<Process> tempProcesses = processes;
-    vector<ExecutionSegment> execution;
+// Runs body(0) .. body(threads - 1) on `threads` threads (the calling thread runs the last
+// one) and waits for all of them
+static void runOnThreads(int threads, const function<void(int)>& body) {
+    vector<thread> workers;
+    for (int t = 0; t + 1 < threads; t++) workers.push_back(thread(body, t));
+    body(threads - 1);
+    for (auto& w : workers) w.join();
+}
 
-    switch (choice) {
-        case 1: {
-            // Execute FCFS algorithm
-            execution = Scheduler::FCFS(tempProcesses);
-            displayResults(tempProcesses, "FCFS");
-            displayGanttChart(execution);
-            break;
+// Number of worker threads to use when the caller passes 0
+static inline int defaultThreadCount() {
+    int threads = thread::hardware_concurrency();
+    return threads > 0 ? threads : 1;
+}
+
+// Runs body(worker, task) for tasks 0 .. tasks - 1 on up to `threads` workers. Each worker
+// starts with a contiguous range of tasks and takes them from the front of its own deque.
+// An idle worker steals from the back of another deque, trying the others in turn from a
+// random one. Neighbouring tasks, which tend to share state, therefore stay on one worker.
+// Tasks never add tasks, so a worker that finds every deque empty is done.
+static void runWorkStealing(int tasks, int threads, const function<void(int, int)>& body) {
+    threads = max(1, min(threads, tasks));
+    vector<deque<int> > queues(threads);
+    vector<mutex> locks(threads);
+    for (int w = 0; w < threads; w++) {
+        for (int t = (long long)tasks * w / threads; t < (long long)tasks * (w + 1) / threads; t++) {
+            queues[w].push_back(t);
         }
-        case 2: {
-            // Execute SJF algorithm
-            execution = Scheduler::SJF(tempProcesses);
+    }
+    runOnThreads(threads, [&](int w) {
+        mt19937 rng(w + 1);
+        while (true) {
+            int task = -1;
+            {
+                lock_guard<mutex> guard(locks[w]);
+                if (!queues[w].empty()) {
+                    task = queues[w].front();
+                    queues[w].pop_front();
+                }
+            }
+            for (int k = 0, start = rng() % threads; task < 0 && k < threads; k++) {
+                int victim = (start + k) % threads;
+                if (victim == w) continue;
+                lock_guard<mutex> guard(locks[victim]);
+                if (!queues[victim].empty()) {
+                    task = queues[victim].back();
+                    queues[victim].pop_back();
+                }
+            }
+            if (task < 0) return;
+            body(w, task);
+        }
+    });
+}
+
+// values[k] += max(floor, gaps[k]) for k < n: the last pass of the max-plus scan in
+// Scheduler::FCFSParallel
+static void addMaxScalar(long long* values, const long long* gaps, long long floor, size_t n) {
+    for (size_t k = 0; k < n; k++) values[k] += max(floor, gaps[k]);
+}
+
+#ifdef CPU_SCHEDULER_X86_KERNELS
+// AVX2 version: four 64-bit lanes per iteration. AVX2 has no 64-bit max, so it is a compare
+// and a blend. Compiled for AVX2 regardless of the build flags and only called when the CPU
+// reports support for it.
+__attribute__((target("avx2")))
+static void addMaxAVX2(long long* values, const long long* gaps, long long floor, size_t n) {
+    __m256i low = _mm256_set1_epi64x(floor);
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256i gap = _mm256_loadu_si256((const __m256i*)(gaps + k));
+        __m256i value = _mm256_loadu_si256((const __m256i*)(values + k));
+        __m256i larger = _mm256_blendv_epi8(low, gap, _mm256_cmpgt_epi64(gap, low));
+        _mm256_storeu_si256((__m256i*)(values + k), _mm256_add_epi64(value, larger));
+    }
+    addMaxScalar(values + k, gaps + k, floor, n - k);
+}
+#endif
+
+static void addMax(long long* values, const long long* gaps, long long floor, size_t n) {
+#ifdef CPU_SCHEDULER_X86_KERNELS
+    static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+    if (hasAVX2) return addMaxAVX2(values, gaps, floor, n);
+#endif
+    addMaxScalar(values, gaps, floor, n);
+}
+
+// Index of the lowest set bit of a non-zero mask (find-first-set)
+static inline int lowestSetBit(unsigned long long mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(mask);
+#else
+    int bit = 0;
+    while (!(mask & 1ULL)) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Linux CFS load weight for a nice value (nice 0 = 1024, each step is roughly 1.25x).
+// The process priority is used as the nice value, clamped to [-20, 19], so a lower number
+// still means a bigger share of the CPU.
+static inline int niceToWeight(int nice) {
+    static const int weights[40] = {
+        88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+        9548,  7620,  6100,  4904,  3906,  3121,  2501,  1991,  1586,  1277,
+        1024,  820,   655,   526,   423,   335,   272,   215,   172,   137,
+        110,   87,    70,    56,    45,    36,    29,    23,    18,    15
+    };
+    if (nice < -20) nice = -20;
+    if (nice > 19) nice = 19;
+    return weights[nice + 20];
+}
+
+// Binary min-heap over the indices 0..n-1, each with a key that can be changed while the
+// index is in the heap (position map). Used by the preemptive engines, where the running
+// process's key changes and it has to be re-inserted or compared against the best waiter.
+template <typename Key>
+class IndexedMinHeap {
+    private:
+        vector<int> heap;     // Heap-ordered indices
+        vector<int> position; // Position of each index in `heap`, -1 when absent
+        vector<Key> keys;
+
+        bool less(int a, int b) const { return keys[heap[a]] < keys[heap[b]]; }
+
+        void swapNodes(int a, int b) {
+            swap(heap[a], heap[b]);
+            position[heap[a]] = a;
+            position[heap[b]] = b;
+        }
+
+        void siftUp(int pos) {
+            while (pos > 0 && less(pos, (pos - 1) / 2)) {
+                swapNodes(pos, (pos - 1) / 2);
+                pos = (pos - 1) / 2;
+            }
+        }
+
+        void siftDown(int pos) {
+            int size = heap.size();
+            while (true) {
+                int smallest = pos;
+                int left = 2 * pos + 1, right = 2 * pos + 2;
+                if (left < size && less(left, smallest)) smallest = left;
+                if (right < size && less(right, smallest)) smallest = right;
+                if (smallest == pos) return;
+                swapNodes(pos, smallest);
+                pos = smallest;
+            }
+        }
+
+    public:
+        explicit IndexedMinHeap(int n) : position(n, -1), keys(n) { heap.reserve(n); }
+
+        bool empty() const { return heap.empty(); }
+        int size() const { return heap.size(); }
+        bool contains(int index) const { return position[index] != -1; }
+        int top() const { return heap[0]; }
+        const Key& topKey() const { return keys[heap[0]]; }
+        const Key& key(int index) const { return keys[index]; }
+
+        void push(int index, const Key& key) {
+            keys[index] = key;
+            position[index] = heap.size();
+            heap.push_back(index);
+            siftUp(heap.size() - 1);
+        }
+
+        int pop() {
+            int index = heap[0];
+            erase(index);
+            return index;
+        }
+
+        void erase(int index) {
+            int pos = position[index];
+            int last = heap.size() - 1;
+            if (pos != last) swapNodes(pos, last);
+            heap.pop_back();
+            position[index] = -1;
+            if (pos < (int)heap.size()) {
+                siftUp(pos);
+                siftDown(pos);
+            }
+        }
+
+        // Changes the key of an index already in the heap
+        void update(int index, const Key& key) {
+            keys[index] = key;
+            siftUp(position[index]);
+            siftDown(position[index]);
+        }
+};
+
+// Treap over process indices ordered by (vruntime, index), where every node also keeps the
+// smallest (deadline, index) found in its subtree. This lets EEVDF find the earliest virtual
+// deadline among eligible processes (vruntime <= V) by walking a single root-to-leaf path,
+// O(log n) expected, instead of scanning every runnable process. AgingReadyQueue reuses it with
+// other keys.
+class EligibilityTree {
+    private:
+        typedef pair<long long, int> Key; // (vruntime or deadline, index)
+
+        struct Node {
+            long long vruntime;
+            long long deadline;
+            unsigned priority; // Heap priority of the treap
+            int left;
+            int right;
+            Key minDeadline;   // Earliest (deadline, index) in this subtree
+        };
+
+        vector<Node> nodes; // Node i belongs to process index i
+        int root;
+        int count;
+
+        Key keyOf(int node) const { return Key(nodes[node].vruntime, node); }
+
+        void pull(int node) {
+            Node& x = nodes[node];
+            x.minDeadline = Key(x.deadline, node);
+            if (x.left != -1) x.minDeadline = min(x.minDeadline, nodes[x.left].minDeadline);
+            if (x.right != -1) x.minDeadline = min(x.minDeadline, nodes[x.right].minDeadline);
+        }
+
+        // Splits `node` into keys < key (left) and keys >= key (right)
+        void split(int node, const Key& key, int& left, int& right) {
+            if (node == -1) {
+                left = right = -1;
+                return;
+            }
+            if (keyOf(node) < key) {
+                split(nodes[node].right, key, nodes[node].right, right);
+                left = node;
+            } else {
+                split(nodes[node].left, key, left, nodes[node].left);
+                right = node;
+            }
+            pull(node);
+        }
+
+        int merge(int left, int right) {
+            if (left == -1) return right;
+            if (right == -1) return left;
+            if (nodes[left].priority > nodes[right].priority) {
+                nodes[left].right = merge(nodes[left].right, right);
+                pull(left);
+                return left;
+            }
+            nodes[right].left = merge(left, nodes[right].left);
+            pull(right);
+            return right;
+        }
+
+        // Inserts `index` below `node` (descending until its treap priority fits)
+        int insertAt(int node, int index) {
+            if (node == -1) return index;
+            if (nodes[index].priority > nodes[node].priority) {
+                split(node, keyOf(index), nodes[index].left, nodes[index].right);
+                pull(index);
+                return index;
+            }
+            if (keyOf(index) < keyOf(node)) {
+                nodes[node].left = insertAt(nodes[node].left, index);
+            } else {
+                nodes[node].right = insertAt(nodes[node].right, index);
+            }
+            pull(node);
+            return node;
+        }
+
+        int eraseAt(int node, int index) {
+            if (node == index) return merge(nodes[node].left, nodes[node].right);
+            if (keyOf(index) < keyOf(node)) {
+                nodes[node].left = eraseAt(nodes[node].left, index);
+            } else {
+                nodes[node].right = eraseAt(nodes[node].right, index);
+            }
+            pull(node);
+            return node;
+        }
+
+    public:
+        explicit EligibilityTree(int n) : nodes(n), root(-1), count(0) {
+            // Deterministic pseudo-random treap priorities (xorshift)
+            unsigned state = 2463534242u;
+            for (int i = 0; i < n; i++) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                nodes[i].priority = state;
+            }
+        }
+
+        bool empty() const { return count == 0; }
+        int size() const { return count; }
+
+        // Smallest vruntime in the tree (the tree must not be empty)
+        long long minVruntime() const {
+            int node = root;
+            while (nodes[node].left != -1) node = nodes[node].left;
+            return nodes[node].vruntime;
+        }
+
+        void insert(int index, long long vruntime, long long deadline) {
+            Node& x = nodes[index];
+            x.vruntime = vruntime;
+            x.deadline = deadline;
+            x.left = x.right = -1;
+            pull(index);
+            root = insertAt(root, index);
+            count++;
+        }
+
+        void erase(int index) {
+            root = eraseAt(root, index);
+            count--;
+        }
+
+        // Index with the earliest (deadline, index) among processes whose vruntime <= limit,
+        // or -1 if there is none
+        int earliestEligible(long long limit) const {
+            Key best(LLONG_MAX, -1);
+            int node = root;
+            while (node != -1) {
+                const Node& x = nodes[node];
+                if (x.vruntime <= limit) {
+                    // This node and its whole left subtree are eligible
+                    best = min(best, Key(x.deadline, node));
+                    if (x.left != -1) best = min(best, nodes[x.left].minDeadline);
+                    node = x.right;
+                } else {
+                    node = x.left;
+                }
+            }
+            return best.second;
+        }
+};
+
+// Ready queue for priority scheduling with aging.
+// A process that entered the queue at time `since` with priority `level` has the effective
+// priority max(0, level - floor((t - since) / agingInterval)) at time t. With
+// z = level * agingInterval + since this is max(0, ceil((z - t) / agingInterval)): it grows
+// with z, and z never changes while the process waits. So the best effective priority at t
+// belongs to the smallest z, and the processes that share it are exactly those with z up to
+// a bound computed from that smallest z. The winner is the best of them by the tie-breakers
+// (arrival, burst, index). An EligibilityTree keyed on z, whose subtree minimum holds the
+// packed tie-breakers, answers both questions on one root-to-leaf path. Each operation is
+// O(log n) expected, whatever the aging interval.
+// An agingInterval <= 0 disables aging: one heap keyed on the raw priority, no floor.
+class AgingReadyQueue {
+    private:
+        struct Entry {
+            int level;
+            int arrivalTime;
+            int burstTime;
+            int index;
+
+            bool operator>(const Entry& other) const {
+                if (level != other.level) return level > other.level;
+                if (arrivalTime != other.arrivalTime) return arrivalTime > other.arrivalTime;
+                if (burstTime != other.burstTime) return burstTime > other.burstTime;
+                return index > other.index;
+            }
+        };
+
+        const vector<int>& arrivalTimes;
+        const vector<int>& burstTimes;
+        int agingInterval;
+        priority_queue<Entry, vector<Entry>, greater<Entry> > unaged; // Without aging
+        EligibilityTree aged;                                         // With aging, keyed on z
+        int count;
+
+        // (arrival, burst) packed so that integer order is their lexicographic order
+        long long tieBreak(int index) const {
+            return arrivalTimes[index] * 4294967296LL + ((long long)burstTimes[index] - INT_MIN);
+        }
+
+        // Best effective priority at `currentTime`, and the largest z that reaches it
+        long long bestLevel(long long currentTime, long long& bound) const {
+            long long level = max(0LL, -floorDiv(currentTime - aged.minVruntime(), agingInterval));
+            bound = currentTime + level * agingInterval;
+            return level;
+        }
+
+    public:
+        // Tie-breaking reads the arrival and burst columns of the workload being scheduled
+        AgingReadyQueue(const vector<int>& arrivalTimes, const vector<int>& burstTimes, int agingInterval)
+            : arrivalTimes(arrivalTimes), burstTimes(burstTimes), agingInterval(agingInterval),
+              aged(agingInterval > 0 ? (int)arrivalTimes.size() : 0), count(0) {}
+
+        bool empty() const { return count == 0; }
+        int size() const { return count; }
+
+        // Adds process `index` that became ready at time `since` with priority `level`
+        void push(int index, int level, int since) {
+            if (agingInterval > 0) {
+                aged.insert(index, (long long)level * agingInterval + since, tieBreak(index));
+            } else {
+                Entry e;
+                e.level = level;
+                e.arrivalTime = arrivalTimes[index];
+                e.burstTime = burstTimes[index];
+                e.index = index;
+                unaged.push(e);
+            }
+            count++;
+        }
+
+        // Returns the process with the lowest effective priority at `currentTime` (ties:
+        // earlier arrival, then smaller burst, then lower index) without removing it. The
+        // effective priority it would be selected with is stored in `effective`.
+        int top(int currentTime, int* effective = nullptr) const {
+            if (agingInterval <= 0) {
+                if (effective) *effective = unaged.top().level;
+                return unaged.top().index;
+            }
+            long long bound;
+            long long level = bestLevel(currentTime, bound);
+            if (effective) *effective = (int)level;
+            return aged.earliestEligible(bound);
+        }
+
+        // Removes and returns the process top() would return at `currentTime`
+        int pop(int currentTime, int* effective = nullptr) {
+            int index = top(currentTime, effective);
+            if (agingInterval > 0) aged.erase(index);
+            else unaged.pop();
+            count--;
+            return index;
+        }
+
+        // Earliest time at which some queued process's effective priority drops strictly
+        // below `level` (LLONG_MAX if that never happens): the smallest z gets there at
+        // z - (level - 1) * agingInterval.
+        long long nextTimeBelow(int level) const {
+            if (agingInterval <= 0 || level <= 0 || count == 0) return LLONG_MAX;
+            return aged.minVruntime() - (long long)(level - 1) * agingInterval;
+        }
+};
+
+// Initial placement policy for Scheduler::MultiCore: decides which core's run queue a
+// process joins. place() is called once per process, in arrival order.
+class PlacementPolicy {
+    public:
+        virtual ~PlacementPolicy() {}
+        // Prepares the policy for a run over `cores` cores
+        virtual void reset(int cores) = 0;
+        // Returns the core (0..cores-1) the process is placed on
+        virtual int place(const Process& process) = 0;
+};
+
+// Cycles through the cores in order
+class RoundRobinPlacement : public PlacementPolicy {
+    private:
+        int cores;
+        int next;
+
+    public:
+        RoundRobinPlacement() : cores(1), next(0) {}
+        void reset(int cores) { this->cores = cores; next = 0; }
+        int place(const Process&) {
+            int core = next;
+            next = (next + 1) % cores;
+            return core;
+        }
+};
+
+// Places each process on the core whose assigned work would finish first if it ran
+// back-to-back (FCFS estimate). A min-heap over cores keeps this O(log cores).
+class LeastLoadedPlacement : public PlacementPolicy {
+    private:
+        typedef pair<long long, int> CoreLoad; // (estimated finish time, core)
+        priority_queue<CoreLoad, vector<CoreLoad>, greater<CoreLoad> > loads;
+
+    public:
+        void reset(int cores) {
+            loads = priority_queue<CoreLoad, vector<CoreLoad>, greater<CoreLoad> >();
+            for (int c = 0; c < cores; c++) loads.push(CoreLoad(0, c));
+        }
+        int place(const Process& process) {
+            CoreLoad least = loads.top();
+            loads.pop();
+            least.first = max(least.first, (long long)process.getArrivalTime()) + process.getBurstTime();
+            loads.push(least);
+            return least.second;
+        }
+};
+
+// Pins each process to core PID mod cores (static affinity)
+class PidHashPlacement : public PlacementPolicy {
+    private:
+        int cores;
+
+    public:
+        PidHashPlacement() : cores(1) {}
+        void reset(int cores) { this->cores = cores; }
+        int place(const Process& process) {
+            int core = process.getPID() % cores;
+            return core < 0 ? core + cores : core;
+        }
+};
+
+// Non-preemptive policy each core runs on its own queue in the work-stealing
+// Scheduler::MultiCore
+enum CoreQueueOrder {
+    CORE_FCFS,     // Arrival order
+    CORE_SJF,      // Shortest burst first
+    CORE_PRIORITY  // Lowest priority number first, no aging
+};
+
+// Load balancing between the cores of the work-stealing Scheduler::MultiCore. An idle core
+// with an empty run queue steals queued (not yet started) processes from another core.
+enum StealPolicy {
+    STEAL_NONE,         // No balancing: processes stay on the core they were placed on
+    STEAL_RANDOM,       // Random victim, steal one process
+    STEAL_HALF,         // Random victim, steal half of its run queue
+    STEAL_POWER_OF_TWO  // Sample two victims, steal half from the longer run queue
+};
+
+// Counters collected by the work-stealing Scheduler::MultiCore
+struct WorkStealingStats {
+    long long stealAttempts;
+    long long successfulSteals;
+    long long migratedProcesses;
+    long long migratedWork; // Total burst time of the migrated processes
+
+    WorkStealingStats() : stealAttempts(0), successfulSteals(0), migratedProcesses(0), migratedWork(0) {}
+};
+
+// Buffered output file writer (CSV, JSON and binary traces); integers are formatted by hand
+class BufferedWriter {
+    private:
+        FILE* out;
+        vector<char> buffer;
+        size_t used;
+        bool failed;
+
+        void flushIfFull(size_t needed) {
+            if (used + needed > buffer.size()) flush();
+        }
+
+    public:
+        explicit BufferedWriter(FILE* out) : out(out), buffer(1 << 20), used(0), failed(false) {}
+
+        void bytes(const void* data, size_t length) {
+            flushIfFull(length);
+            if (length > buffer.size()) {
+                failed |= fwrite(data, 1, length, out) != length;
+                return;
+            }
+            memcpy(buffer.data() + used, data, length);
+            used += length;
+        }
+
+        void text(const string& s) { bytes(s.data(), s.size()); }
+
+        void integer(long long v) {
+            flushIfFull(24);
+            char digits[24];
+            int len = 0;
+            unsigned long long u = v < 0 ? 0ULL - (unsigned long long)v : (unsigned long long)v;
+            do {
+                digits[len++] = '0' + u % 10;
+                u /= 10;
+            } while (u);
+            if (v < 0) buffer[used++] = '-';
+            while (len) buffer[used++] = digits[--len];
+        }
+
+        void character(char c) {
+            flushIfFull(1);
+            buffer[used++] = c;
+        }
+
+        void flush() {
+            if (used) failed |= fwrite(buffer.data(), 1, used, out) != used;
+            used = 0;
+        }
+
+        bool good() const { return !failed; }
+};
+
+// Rows of the Gantt chart and tracks of exported traces: one lane per process, or one per
+// core for multi-core runs
+enum GanttLanes {
+    LANES_AUTO,       // Per core if any segment ran on a core other than 0, else per process
+    LANES_BY_PROCESS,
+    LANES_BY_CORE
+};
+
+// Segment sinks. The event-driven engines in Scheduler take the sink as a template parameter
+// and push each ExecutionSegment to it as soon as the segment ends, instead of returning a
+// vector of all of them. Any type with a push(const ExecutionSegment&) member works.
+
+// Discards every segment; the calls inline to nothing, for runs that only need the metrics
+struct NullSink {
+    void push(const ExecutionSegment&) {}
+};
+
+// Counts segments and the CPU time they cover
+struct CountingSink {
+    long long segments;
+    long long busyTime;
+
+    CountingSink() : segments(0), busyTime(0) {}
+
+    void push(const ExecutionSegment& segment) {
+        segments++;
+        busyTime += segment.endTime - segment.startTime;
+    }
+};
+
+// Keeps every segment in memory (what the vector-returning engines use)
+struct VectorSink {
+    vector<ExecutionSegment> segments;
+
+    void push(const ExecutionSegment& segment) { segments.push_back(segment); }
+};
+
+// Streams segments to a CSV file ("pid,start,end,core" per line, after `label` if given)
+class FileSink {
+    private:
+        BufferedWriter& out;
+        string label;
+
+    public:
+        explicit FileSink(BufferedWriter& out, const string& label = "") : out(out), label(label) {}
+
+        void push(const ExecutionSegment& segment) {
+            if (!label.empty()) {
+                out.text(label);
+                out.character(',');
+            }
+            out.integer(segment.processID);
+            out.character(',');
+            out.integer(segment.startTime);
+            out.character(',');
+            out.integer(segment.endTime);
+            out.character(',');
+            out.integer(segment.coreID);
+            out.character('\n');
+        }
+};
+
+// Run-length coalescing stage in front of another sink: a segment that continues the
+// previous one (same process and core, starting when it ended) extends it instead of being
+// forwarded. Only the pending segment is buffered; call flush() after the engine returns.
+// With `enabled` false segments pass straight through, but both counts are still kept.
+template <class Downstream>
+class CoalescingSink {
+    private:
+        Downstream& out;
+        bool enabled;
+        bool hasPending;
+        ExecutionSegment pending; // Current run (or, when disabled, the last segment)
+
+    public:
+        long long received;  // Segments pushed by the engine
+        long long coalesced; // Segments left after merging
+
+        explicit CoalescingSink(Downstream& out, bool enabled = true)
+            : out(out), enabled(enabled), hasPending(false), received(0), coalesced(0) {}
+
+        void push(const ExecutionSegment& segment) {
+            received++;
+            bool continues = hasPending && pending.processID == segment.processID &&
+                             pending.coreID == segment.coreID && pending.endTime == segment.startTime;
+            if (!continues) coalesced++;
+            if (!enabled) {
+                out.push(segment);
+                pending = segment;
+                hasPending = true;
+            } else if (continues) {
+                pending.endTime = segment.endTime;
+            } else {
+                flush();
+                pending = segment;
+                hasPending = true;
+            }
+        }
+
+        void flush() {
+            if (enabled && hasPending) out.push(pending);
+            hasPending = false;
+        }
+};
+
+// Returns `execution` with back-to-back segments of the same process merged
+vector<ExecutionSegment> coalesceSegments(const vector<ExecutionSegment>& execution) {
+    VectorSink merged;
+    CoalescingSink<VectorSink> coalescer(merged);
+    for (const auto& seg : execution) coalescer.push(seg);
+    coalescer.flush();
+    return move(merged.segments);
+}
+
+// Trace export. Both writers are segment sinks: each algorithm run becomes one process in the
+// viewer (beginProcess), with one track per PID (or per core with LANES_BY_CORE; LANES_AUTO
+// means per PID here) created the first time it is seen, and a "ready queue" counter track.
+// One time unit of the simulation is shown as one microsecond.
+
+// Chrome JSON trace events, loadable in chrome://tracing and ui.perfetto.dev
+class ChromeTraceWriter {
+    private:
+        BufferedWriter& out;
+        GanttLanes lanes;
+        bool firstEvent;
+        int process;
+        unordered_set<int> namedLanes;
+
+        void beginEvent() {
+            out.text(firstEvent ? "\n" : ",\n");
+            firstEvent = false;
+        }
+
+        void quoted(const string& s) {
+            out.character('"');
+            for (char c : s) {
+                if (c == '"' || c == '\\') out.character('\\');
+                out.character(c);
+            }
+            out.character('"');
+        }
+
+    public:
+        explicit ChromeTraceWriter(BufferedWriter& out, GanttLanes lanes = LANES_BY_PROCESS)
+            : out(out), lanes(lanes), firstEvent(true), process(0) {
+            out.text("{\"traceEvents\":[");
+        }
+
+        void beginProcess(const string& name) {
+            process++;
+            namedLanes.clear();
+            beginEvent();
+            out.text("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":");
+            out.integer(process);
+            out.text(",\"args\":{\"name\":");
+            quoted(name);
+            out.text("}}");
+        }
+
+        void push(const ExecutionSegment& segment) {
+            int lane = lanes == LANES_BY_CORE ? segment.coreID : segment.processID;
+            if (namedLanes.insert(lane).second) {
+                beginEvent();
+                out.text("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":");
+                out.integer(process);
+                out.text(",\"tid\":");
+                out.integer(lane);
+                out.text(",\"args\":{\"name\":\"");
+                out.text(lanes == LANES_BY_CORE ? "Core " : "P");
+                out.integer(lane);
+                out.text("\"}}");
+            }
+            beginEvent();
+            out.text("{\"name\":\"P");
+            out.integer(segment.processID);
+            out.text("\",\"ph\":\"X\",\"pid\":");
+            out.integer(process);
+            out.text(",\"tid\":");
+            out.integer(lane);
+            out.text(",\"ts\":");
+            out.integer(segment.startTime);
+            out.text(",\"dur\":");
+            out.integer(segment.endTime - segment.startTime);
+            out.character('}');
+        }
+
+        void counter(long long time, long long readyQueueLength) {
+            beginEvent();
+            out.text("{\"name\":\"ready queue\",\"ph\":\"C\",\"pid\":");
+            out.integer(process);
+            out.text(",\"ts\":");
+            out.integer(time);
+            out.text(",\"args\":{\"length\":");
+            out.integer(readyQueueLength);
+            out.text("}}");
+        }
+
+        void finish() { out.text("\n]}\n"); }
+};
+
+// Minimal protocol buffer encoder for the Perfetto messages below
+class ProtoMessage {
+    private:
+        vector<unsigned char> bytes;
+
+        void varint(uint64_t v) {
+            while (v >= 0x80) {
+                bytes.push_back((unsigned char)(v | 0x80));
+                v >>= 7;
+            }
+            bytes.push_back((unsigned char)v);
+        }
+
+        void key(int field, int wireType) { varint(((uint64_t)field << 3) | wireType); }
+
+    public:
+        void clear() { bytes.clear(); }
+
+        // int32/int64/uint64/enum fields (negative values take ten bytes, as in protobuf)
+        ProtoMessage& integer(int field, int64_t value) {
+            key(field, 0);
+            varint((uint64_t)value);
+            return *this;
+        }
+
+        ProtoMessage& text(int field, const string& value) {
+            key(field, 2);
+            varint(value.size());
+            bytes.insert(bytes.end(), value.begin(), value.end());
+            return *this;
+        }
+
+        ProtoMessage& message(int field, const ProtoMessage& value) {
+            key(field, 2);
+            varint(value.bytes.size());
+            bytes.insert(bytes.end(), value.bytes.begin(), value.bytes.end());
+            return *this;
+        }
+
+        const vector<unsigned char>& data() const { return bytes; }
+};
+
+// Perfetto binary trace (a perfetto.protos.Trace: a stream of TracePacket messages), written
+// packet by packet through the buffered writer, so memory stays bounded for any run length.
+// Slices are TrackEvent begin/end pairs on per-lane tracks.
+class PerfettoTraceWriter {
+    private:
+        // Field numbers from perfetto/protos/perfetto/trace/
+        enum {
+            TRACE_PACKET = 1,
+            PACKET_TIMESTAMP = 8, PACKET_SEQUENCE_ID = 10, PACKET_TRACK_EVENT = 11,
+            PACKET_SEQUENCE_FLAGS = 13, PACKET_TRACK_DESCRIPTOR = 60,
+            TRACK_UUID = 1, TRACK_NAME = 2, TRACK_PROCESS = 3, TRACK_PARENT_UUID = 5, TRACK_COUNTER = 8,
+            PROCESS_PID = 1, PROCESS_NAME = 6,
+            EVENT_TYPE = 9, EVENT_TRACK_UUID = 11, EVENT_NAME = 23, EVENT_COUNTER_VALUE = 30,
+            SLICE_BEGIN = 1, SLICE_END = 2, COUNTER = 4,
+            SEQUENCE_ID = 1, SEQ_INCREMENTAL_STATE_CLEARED = 1
+        };
+
+        BufferedWriter& out;
+        GanttLanes lanes;
+        int process;
+        bool firstPacket;
+        unordered_set<int> describedLanes;
+        ProtoMessage packet, body, inner; // Reused scratch messages
+
+        // Track ids: bit 32 set for lane tracks, so they never collide with the process and
+        // counter tracks of the same run
+        uint64_t processTrack() const { return (uint64_t)process << 33; }
+        uint64_t counterTrack() const { return processTrack() | 1; }
+        uint64_t laneTrack(int lane) const { return processTrack() | (1ULL << 32) | (uint32_t)lane; }
+
+        void writePacket() {
+            packet.integer(PACKET_SEQUENCE_ID, SEQUENCE_ID);
+            if (firstPacket) packet.integer(PACKET_SEQUENCE_FLAGS, SEQ_INCREMENTAL_STATE_CLEARED);
+            firstPacket = false;
+            unsigned char header[11];
+            int length = 0;
+            header[length++] = (TRACE_PACKET << 3) | 2;
+            uint64_t size = packet.data().size();
+            while (size >= 0x80) {
+                header[length++] = (unsigned char)(size | 0x80);
+                size >>= 7;
+            }
+            header[length++] = (unsigned char)size;
+            out.bytes(header, length);
+            out.bytes(packet.data().data(), packet.data().size());
+        }
+
+        void trackEvent(long long time, int type, uint64_t track, const string* name, long long value = 0) {
+            body.clear();
+            body.integer(EVENT_TYPE, type).integer(EVENT_TRACK_UUID, track);
+            if (name) body.text(EVENT_NAME, *name);
+            if (type == COUNTER) body.integer(EVENT_COUNTER_VALUE, value);
+            packet.clear();
+            packet.integer(PACKET_TIMESTAMP, time * 1000).message(PACKET_TRACK_EVENT, body);
+            writePacket();
+        }
+
+    public:
+        explicit PerfettoTraceWriter(BufferedWriter& out, GanttLanes lanes = LANES_BY_PROCESS)
+            : out(out), lanes(lanes), process(0), firstPacket(true) {}
+
+        void beginProcess(const string& name) {
+            process++;
+            describedLanes.clear();
+
+            inner.clear();
+            inner.integer(PROCESS_PID, process).text(PROCESS_NAME, name);
+            body.clear();
+            body.integer(TRACK_UUID, processTrack()).message(TRACK_PROCESS, inner);
+            packet.clear();
+            packet.message(PACKET_TRACK_DESCRIPTOR, body);
+            writePacket();
+
+            inner.clear();
+            body.clear();
+            body.integer(TRACK_UUID, counterTrack()).integer(TRACK_PARENT_UUID, processTrack())
+                .text(TRACK_NAME, "ready queue").message(TRACK_COUNTER, inner);
+            packet.clear();
+            packet.message(PACKET_TRACK_DESCRIPTOR, body);
+            writePacket();
+        }
+
+        void push(const ExecutionSegment& segment) {
+            int lane = lanes == LANES_BY_CORE ? segment.coreID : segment.processID;
+            if (describedLanes.insert(lane).second) {
+                body.clear();
+                body.integer(TRACK_UUID, laneTrack(lane)).integer(TRACK_PARENT_UUID, processTrack())
+                    .text(TRACK_NAME, (lanes == LANES_BY_CORE ? "Core " : "P") + to_string(lane));
+                packet.clear();
+                packet.message(PACKET_TRACK_DESCRIPTOR, body);
+                writePacket();
+            }
+            string name = "P" + to_string(segment.processID);
+            trackEvent(segment.startTime, SLICE_BEGIN, laneTrack(lane), &name);
+            trackEvent(segment.endTime, SLICE_END, laneTrack(lane), nullptr);
+        }
+
+        void counter(long long time, long long readyQueueLength) {
+            trackEvent(time, COUNTER, counterTrack(), nullptr, readyQueueLength);
+        }
+
+        void finish() {}
+};
+
+// Records when the (single) CPU is busy: segments in time order, merged into maximal busy
+// periods, so a run that never idles keeps one entry however many segments it has
+struct BusyPeriods {
+    vector<pair<int, int> > periods; // [start, end)
+
+    void push(const ExecutionSegment& segment) {
+        if (segment.endTime <= segment.startTime) return;
+        if (!periods.empty() && segment.startTime <= periods.back().second) {
+            periods.back().second = max(periods.back().second, segment.endTime);
+        } else {
+            periods.push_back(make_pair(segment.startTime, segment.endTime));
+        }
+    }
+};
+
+// Writes the ready-queue length over a finished single-CPU run as counter events, one per
+// change: processes that have arrived and not completed, minus the one on the CPU while it
+// is busy. Engines need not be work-conserving (sjf can leave the CPU idle with processes
+// waiting), so the busy periods come from the run's own segments.
+template <class TraceWriter>
+void writeReadyQueueCounters(TraceWriter& trace, const Workload& workload, const BusyPeriods& busy) {
+    vector<int> arrivals = workload.arrival, completions = workload.completion;
+    sort(arrivals.begin(), arrivals.end());
+    sort(completions.begin(), completions.end());
+    const vector<pair<int, int> >& periods = busy.periods;
+    size_t a = 0, c = 0, b = 0, n = arrivals.size();
+    long long inSystem = 0, last = -1;
+    bool running = false;
+    while (a < n || c < n || b < periods.size()) {
+        // Next time anything changes: an arrival, a completion, or a busy period starting or ending
+        long long t = LLONG_MAX;
+        if (a < n) t = min(t, (long long)arrivals[a]);
+        if (c < n) t = min(t, (long long)completions[c]);
+        if (b < periods.size()) t = min(t, (long long)(running ? periods[b].second : periods[b].first));
+        while (a < n && arrivals[a] == t) { inSystem++; a++; }
+        while (c < n && completions[c] == t) { inSystem--; c++; }
+        if (b < periods.size() && !running && periods[b].first == t) running = true;
+        if (b < periods.size() && running && periods[b].second == t) {
+            running = false;
+            b++;
+        }
+        long long ready = max(0LL, inSystem - (running ? 1 : 0));
+        if (ready != last) trace.counter(t, ready);
+        last = ready;
+    }
+}
+
+class Scheduler {
+public:
+    // Single-core policy run on each core's run queue by MultiCore(), e.g.
+    // [](vector<Process>& p) { return Scheduler::RoundRobinEventDriven(p, 4); }
+    typedef function<vector<ExecutionSegment>(vector<Process>&)> CoreEngine;
+
+    // FCFS - First Come First Served
+    static vector<ExecutionSegment> FCFS(vector<Process>& processes) {
+        vector<ExecutionSegment> execution;
+        
+        sort(processes.begin(), processes.end(),
+             [](const Process& a, const Process& b) {
+                 return a.getArrivalTime() < b.getArrivalTime();
+             });
+
+        int currentTime = 0;
+        for (auto& p : processes) {
+            if (currentTime < p.getArrivalTime()) {
+                currentTime = p.getArrivalTime();
+            }
+            int startTime = currentTime;
+            currentTime += p.getBurstTime();
+            p.resetRunStats();
+            p.recordDispatch(startTime);
+            p.setCompletionTime(currentTime);
+            p.calculateTurnaroundTime();
+            p.calculateWaitingTime();
+            p.calculateResponseTime();
+            
+            execution.push_back({p.getPID(), startTime, currentTime});
+        }
+        
+        return execution;
+    }
+
+    // FCFS - Parallel engine (max-plus prefix scan)
+    // Same schedule as FCFS(): with processes sorted by arrival, completion times follow
+    // C[i] = max(C[i-1], A[i]) + B[i]. Writing P[i] for the running sum of bursts, this is
+    // C[i] = P[i] + max(C[-1], M[i]) where M[i] = max over j <= i of (A[j] - P[j-1]), and both
+    // running sums compose across blocks. Each thread scans its own block for P and M, one
+    // serial pass over the per-block totals gives every block's incoming completion time, and
+    // the final pass C[i] = P[i] + max(carry, M[i]) runs through addMax(), which uses AVX2
+    // when the CPU has it. `threads` = 0 uses every hardware thread. Rows are not reordered; equal
+    // arrival times keep their input order, so ties may run differently than in FCFS().
+    // Segments are pushed to `sink` in arrival order after the parallel passes.
+    template <class Sink>
+    static void FCFSParallel(Workload& workload, Sink& sink, int threads = 0) {
+        int n = workload.size();
+        workload.reset();
+        if (threads <= 0) threads = defaultThreadCount();
+        // Small inputs are not worth the thread start-up cost
+        const int MIN_BLOCK = 1 << 15;
+        threads = max(1, min(threads, n / MIN_BLOCK));
+
+        // Scan order: the rows themselves when already sorted by arrival
+        vector<int> order;
+        if (!is_sorted(workload.arrival.begin(), workload.arrival.end())) {
+            order.resize(n);
+            for (int i = 0; i < n; i++) order[i] = i;
+            stable_sort(order.begin(), order.end(),
+                        [&workload](int a, int b) { return workload.arrival[a] < workload.arrival[b]; });
+        }
+        auto row = [&order](int k) { return order.empty() ? k : order[k]; };
+
+        vector<long long> burstSum(n);   // P[k], running sum of bursts within the block
+        vector<long long> arrivalGap(n); // M[k], running max of A[j] - P[j-1] within the block
+        vector<long long> blockBurst(threads, 0);
+        vector<long long> blockGap(threads, LLONG_MIN);
+        vector<long long> carryIn(threads, 0);
+
+        auto blockBegin = [n, threads](int t) { return (int)((long long)n * t / threads); };
+
+        // Pass 1: per-block running sums
+        runOnThreads(threads, [&](int t) {
+            long long sum = 0, gap = LLONG_MIN;
+            for (int k = blockBegin(t); k < blockBegin(t + 1); k++) {
+                int i = row(k);
+                gap = max(gap, workload.arrival[i] - sum);
+                sum += workload.burst[i];
+                burstSum[k] = sum;
+                arrivalGap[k] = gap;
+            }
+            blockBurst[t] = sum;
+            blockGap[t] = gap;
+        });
+
+        // Pass 2: completion time entering each block (the CPU starts free at time 0)
+        long long carry = 0;
+        for (int t = 0; t < threads; t++) {
+            carryIn[t] = carry;
+            if (blockBurst[t] > 0 || blockGap[t] != LLONG_MIN) carry = blockBurst[t] + max(carry, blockGap[t]);
+        }
+
+        // Pass 3: completion times. Each block records into its own metrics, merged afterwards.
+        vector<CompletionMetrics> blockMetrics(workload.metrics ? threads : 0);
+        runOnThreads(threads, [&](int t) {
+            int begin = blockBegin(t), end = blockBegin(t + 1);
+            addMax(burstSum.data() + begin, arrivalGap.data() + begin, carryIn[t], end - begin);
+            for (int k = begin; k < end; k++) {
+                int i = row(k);
+                int completion = (int)burstSum[k];
+                int start = completion - workload.burst[i];
+                workload.completion[i] = completion;
+                workload.remaining[i] = 0;
+                workload.firstDispatch[i] = start;
+                workload.contextSwitches[i] = 1;
+                if (workload.metrics) {
+                    blockMetrics[t].turnaround.record(completion - workload.arrival[i]);
+                    blockMetrics[t].waiting.record(start - workload.arrival[i]);
+                    blockMetrics[t].response.record(start - workload.arrival[i]);
+                    blockMetrics[t].makespan = max(blockMetrics[t].makespan, completion);
+                }
+            }
+        });
+        for (const auto& m : blockMetrics) workload.metrics->merge(m);
+
+        for (int k = 0; k < n; k++) {
+            int i = row(k);
+            sink.push(ExecutionSegment(workload.pid[i], workload.firstDispatch[i], workload.completion[i]));
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> FCFSParallel(Workload& workload, int threads = 0) {
+        VectorSink sink;
+        sink.segments.reserve(workload.size());
+        FCFSParallel(workload, sink, threads);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: like FCFS(), `processes` is left sorted by arrival
+    static vector<ExecutionSegment> FCFSParallel(vector<Process>& processes, int threads = 0) {
+        auto byArrivalTime = [](const Process& a, const Process& b) { return a.getArrivalTime() < b.getArrivalTime(); };
+        if (!is_sorted(processes.begin(), processes.end(), byArrivalTime)) {
+            stable_sort(processes.begin(), processes.end(), byArrivalTime);
+        }
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = FCFSParallel(workload, threads);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // SJF - Shortest Job First (Non-preemptive)
+    // This algorithm selects the process with the shortest burst time that has arrived by the current time.
+    // It is non-preemptive, meaning once a process starts, it runs to completion.
+    static vector<ExecutionSegment> SJF(vector<Process>& processes) {
+        vector<ExecutionSegment> execution;
+        vector<bool> processed(processes.size(), false); // Track which processes have been completed
+        int currentTime = 0; // Current simulation time
+        int completed = 0; // Number of processes completed
+
+        // Continue until all processes are completed
+        while (completed < processes.size()) {
+            int shortest = -1; // Index of the shortest job found
+            int shortestBurst = INT_MAX; // Burst time of the shortest job
+
+            // Find the process with the smallest burst time that has arrived and not yet processed
+            for (int i = 0; i < processes.size(); i++) {
+                if (!processed[i] && processes[i].getArrivalTime() <= currentTime &&
+                    processes[i].getBurstTime() < shortestBurst) {
+                    shortest = i;
+                    shortestBurst = processes[i].getBurstTime();
+                }
+            }
+
+            // If no process has arrived yet, advance time to the next arrival time
+            if (shortest == -1) {
+                for (int i = 0; i < processes.size(); i++) {
+                    if (!processed[i]) {
+                        currentTime = processes[i].getArrivalTime();
+                        shortest = i;
+                        break;
+                    }
+                }
+            }
+
+            // Execute the selected process
+            processed[shortest] = true;
+            int startTime = currentTime;
+            currentTime += processes[shortest].getBurstTime();
+            processes[shortest].resetRunStats();
+            processes[shortest].recordDispatch(startTime);
+            processes[shortest].setCompletionTime(currentTime);
+            processes[shortest].calculateTurnaroundTime();
+            processes[shortest].calculateWaitingTime();
+            processes[shortest].calculateResponseTime();
+            
+            execution.push_back({processes[shortest].getPID(), startTime, currentTime});
+            completed++;
+        }
+        
+        return execution;
+    }
+
+    // SJF - Event-driven engine (Non-preemptive)
+    // Produces exactly the same schedule as SJF() above, which is kept as the reference
+    // implementation. Processes are admitted in arrival order and only the ones that have
+    // arrived are kept in a min-heap keyed on (burst time, index), so each dispatch costs
+    // O(log n) instead of a rescan of every process.
+    template <class Sink>
+    static void SJFEventDriven(Workload& workload, Sink& sink) {
+        int n = workload.size();
+        workload.reset();
+
+        // Process indices ordered by arrival time (stable, so equal arrivals keep input order)
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        // Arrived processes: smallest burst first, lowest index on ties (same as the
+        // strict '<' scan in the reference implementation)
+        typedef pair<int, int> BurstKey;
+        priority_queue<BurstKey, vector<BurstKey>, greater<BurstKey> > ready;
+        vector<bool> processed(n, false);
+        int nextArrival = 0;      // Position in byArrival of the next process to admit
+        int firstUnprocessed = 0; // Lowest index not yet processed (used when the CPU is idle)
+        int currentTime = 0;
+
+        for (int completed = 0; completed < n; completed++) {
+            // Admit every process that has arrived by the current time
+            while (nextArrival < n &&
+                   workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                int i = byArrival[nextArrival++];
+                if (!processed[i]) ready.push(BurstKey(workload.burst[i], i));
+            }
+
+            int shortest;
+            if (!ready.empty()) {
+                shortest = ready.top().second;
+                ready.pop();
+            } else {
+                // No process has arrived yet: like the reference, jump to the arrival time
+                // of the lowest-index unprocessed process and run it
+                while (processed[firstUnprocessed]) firstUnprocessed++;
+                shortest = firstUnprocessed;
+                currentTime = workload.arrival[shortest];
+            }
+
+            // Execute the selected process to completion
+            processed[shortest] = true;
+            int startTime = currentTime;
+            currentTime += workload.burst[shortest];
+            workload.complete(shortest, currentTime);
+
+            workload.dispatch(shortest, startTime);
+            sink.push(ExecutionSegment(workload.pid[shortest], startTime, currentTime));
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> SJFEventDriven(Workload& workload) {
+        VectorSink sink;
+        SJFEventDriven(workload, sink);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> SJFEventDriven(vector<Process>& processes) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = SJFEventDriven(workload);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // Round Robin
+    // This preemptive algorithm uses a time quantum. Each process gets a fixed time slice (quantum).
+    // If a process doesn't finish in its quantum, it's preempted and placed back in the queue.
+    // Processes are enqueued in arrival order initially.
+    static vector<ExecutionSegment> RoundRobin(vector<Process>& processes, int timeQuantum) {
+        vector<ExecutionSegment> execution;
+        queue<int> q; // Queue to hold process indices
+        vector<int> remainingTime(processes.size()); // Remaining burst time for each process
+        
+        // Initialize remaining times
+        for (int i = 0; i < processes.size(); i++) {
+            remainingTime[i] = processes[i].getBurstTime();
+        }
+
+        // Sort processes by arrival time to enqueue them in order
+        sort(processes.begin(), processes.end(),
+             [](const Process& a, const Process& b) {
+                 return a.getArrivalTime() < b.getArrivalTime();
+             });
+
+        // Enqueue all processes initially (assuming they arrive at time 0 or later, but queue handles order)
+        for (int i = 0; i < processes.size(); i++) {
+            q.push(i);
+            processes[i].resetRunStats();
+        }
+
+        int currentTime = 0;
+        int previous = -1; // Process that ran the last time slice
+        // Process the queue until empty
+        while (!q.empty()) {
+            int idx = q.front();
+            q.pop();
+
+            int startTime = currentTime;
+            // A requeued process picked again right away keeps the CPU (no context switch)
+            if (idx != previous) {
+                if (previous >= 0 && remainingTime[previous] > 0) processes[previous].preemptions++;
+                processes[idx].recordDispatch(startTime);
+                previous = idx;
+            }
+            // If remaining time > quantum, execute for quantum and requeue
+            if (remainingTime[idx] > timeQuantum) {
+                currentTime += timeQuantum;
+                remainingTime[idx] -= timeQuantum;
+                execution.push_back({processes[idx].getPID(), startTime, currentTime});
+                q.push(idx); // Requeue the process
+            } else {
+                // Execute for remaining time and complete the process
+                currentTime += remainingTime[idx];
+                remainingTime[idx] = 0;
+                processes[idx].setCompletionTime(currentTime);
+                processes[idx].calculateTurnaroundTime();
+                processes[idx].calculateWaitingTime();
+                processes[idx].calculateResponseTime();
+                execution.push_back({processes[idx].getPID(), startTime, currentTime});
+            }
+        }
+        
+        return execution;
+    }
+
+    // Round Robin - Arrival-aware, event-driven engine
+    // Unlike RoundRobin() above, a process only joins the ready queue once it has arrived;
+    // if the queue is empty the clock jumps to the next arrival. Processes arriving during a
+    // time slice are enqueued before the preempted process. When a process is alone in the
+    // ready queue it keeps getting consecutive quanta until the next arrival, so all of those
+    // rounds are fast-forwarded in closed form and emitted as one segment. Cost is
+    // O(n log n + context switches) rather than O(total burst / quantum).
+    template <class Sink>
+    static void RoundRobinEventDriven(Workload& workload, Sink& sink, int timeQuantum) {
+        int n = workload.size();
+        queue<int> q; // Ready queue of process indices
+        workload.reset();
+
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        int nextArrival = 0; // Position in byArrival of the next process to admit
+        int currentTime = 0;
+        int completed = 0;
+        while (completed < n) {
+            // Idle CPU: jump to the next arrival
+            if (q.empty() && workload.arrival[byArrival[nextArrival]] > currentTime) {
+                currentTime = workload.arrival[byArrival[nextArrival]];
+            }
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                q.push(byArrival[nextArrival++]);
+            }
+
+            int idx = q.front();
+            q.pop();
+
+            // Length of this run: one quantum, or when nobody else is waiting, every
+            // quantum up to (and including) the one during which the next process arrives
+            long long runTime = timeQuantum;
+            if (q.empty()) {
+                if (nextArrival == n) {
+                    runTime = workload.remaining[idx];
+                } else {
+                    long long gap = (long long)workload.arrival[byArrival[nextArrival]] - currentTime;
+                    long long rounds = max(1LL, (gap + timeQuantum - 1) / timeQuantum);
+                    runTime = rounds * timeQuantum;
+                }
+            }
+            if (runTime > workload.remaining[idx]) runTime = workload.remaining[idx];
+
+            int startTime = currentTime;
+            currentTime += (int)runTime;
+            workload.remaining[idx] -= (int)runTime;
+            workload.dispatch(idx, startTime);
+            sink.push(ExecutionSegment(workload.pid[idx], startTime, currentTime));
+
+            // Processes that arrived during the slice go ahead of the preempted one
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                q.push(byArrival[nextArrival++]);
+            }
+
+            if (workload.remaining[idx] > 0) {
+                q.push(idx); // Requeue the process
+            } else {
+                workload.complete(idx, currentTime);
+                completed++;
+            }
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> RoundRobinEventDriven(Workload& workload, int timeQuantum) {
+        VectorSink sink;
+        RoundRobinEventDriven(workload, sink, timeQuantum);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> RoundRobinEventDriven(vector<Process>& processes, int timeQuantum) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = RoundRobinEventDriven(workload, timeQuantum);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // MLFQ - Multi-Level Feedback Queue
+    // levelQuanta[k] is the time quantum of level k (level 0 is the highest priority, at most
+    // 64 levels). New processes enter level 0; a process that uses up its quantum is demoted
+    // one level (the last level behaves like Round Robin). A process arriving while a lower
+    // level runs preempts it at the arrival instant; the preempted process stays on its level.
+    // Every `boostPeriod` time units (0 disables it) all waiting processes are moved back to
+    // level 0, applied at the next dispatch. Each level is a Round Robin queue and a bitmap of
+    // non-empty levels makes picking the next process a single find-first-set. A process alone
+    // on the last level gets its quanta up to the next arrival or boost fast-forwarded into one
+    // segment, as in RoundRobinEventDriven().
+    template <class Sink>
+    static void MLFQ(Workload& workload, Sink& sink, const vector<int>& levelQuanta,
+                     int boostPeriod = 0) {
+        int n = workload.size();
+        int levels = levelQuanta.size();
+        vector<queue<int> > queues(levels);
+        unsigned long long nonEmpty = 0; // Bit k is set while queues[k] is non-empty
+        vector<int> level(n, 0);
+        workload.reset();
+
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        int nextArrival = 0; // Position in byArrival of the next process to admit
+        long long nextBoost = boostPeriod > 0 ? boostPeriod : LLONG_MAX;
+        int currentTime = 0;
+        int completed = 0;
+
+        while (completed < n) {
+            // Idle CPU: jump to the next arrival
+            if (nonEmpty == 0 && workload.arrival[byArrival[nextArrival]] > currentTime) {
+                currentTime = workload.arrival[byArrival[nextArrival]];
+            }
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                int i = byArrival[nextArrival++];
+                level[i] = 0;
+                queues[0].push(i);
+                nonEmpty |= 1ULL;
+            }
+
+            // Priority boost: move everything back to level 0, keeping the level order
+            if (currentTime >= nextBoost) {
+                for (int k = 1; k < levels; k++) {
+                    while (!queues[k].empty()) {
+                        int i = queues[k].front();
+                        queues[k].pop();
+                        level[i] = 0;
+                        queues[0].push(i);
+                    }
+                }
+                if (nonEmpty) nonEmpty = 1ULL;
+                nextBoost = (currentTime / boostPeriod + 1) * (long long)boostPeriod;
+            }
+
+            int lv = lowestSetBit(nonEmpty);
+            int idx = queues[lv].front();
+            queues[lv].pop();
+            if (queues[lv].empty()) nonEmpty &= ~(1ULL << lv);
+
+            long long upcomingArrival = nextArrival < n ? workload.arrival[byArrival[nextArrival]] : LLONG_MAX;
+            long long quantum = levelQuanta[lv];
+            long long runTime = quantum;
+            if (nonEmpty == 0 && lv == levels - 1) {
+                // Alone on the last level: it keeps being redispatched until an arrival or a boost
+                long long target = min(upcomingArrival, nextBoost);
+                if (target == LLONG_MAX) {
+                    runTime = workload.remaining[idx];
+                } else {
+                    runTime = max(1LL, (target - currentTime + quantum - 1) / quantum) * quantum;
+                }
+            }
+            if (runTime > workload.remaining[idx]) runTime = workload.remaining[idx];
+
+            // A new arrival (level 0) preempts a process running on a lower level
+            bool preempted = false;
+            if (lv > 0 && upcomingArrival < currentTime + runTime) {
+                runTime = upcomingArrival - currentTime;
+                preempted = true;
+            }
+
+            int startTime = currentTime;
+            currentTime += (int)runTime;
+            workload.remaining[idx] -= (int)runTime;
+            workload.dispatch(idx, startTime);
+            sink.push(ExecutionSegment(workload.pid[idx], startTime, currentTime));
+
+            // Processes that arrived during the slice go ahead of the preempted one
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                int i = byArrival[nextArrival++];
+                level[i] = 0;
+                queues[0].push(i);
+                nonEmpty |= 1ULL;
+            }
+
+            if (workload.remaining[idx] > 0) {
+                // Used up its quantum: demote; preempted by an arrival: stay on the same level
+                if (!preempted && level[idx] < levels - 1) level[idx]++;
+                queues[level[idx]].push(idx);
+                nonEmpty |= 1ULL << level[idx];
+            } else {
+                workload.complete(idx, currentTime);
+                completed++;
+            }
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> MLFQ(Workload& workload, const vector<int>& levelQuanta,
+                                         int boostPeriod = 0) {
+        VectorSink sink;
+        MLFQ(workload, sink, levelQuanta, boostPeriod);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> MLFQ(vector<Process>& processes, const vector<int>& levelQuanta,
+                                         int boostPeriod = 0) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = MLFQ(workload, levelQuanta, boostPeriod);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // Priority Scheduling (Non-preemptive) - Lower priority number = higher priority
+    // This algorithm selects the process with the highest priority (lowest number) that has arrived.
+    // If withAging is true, priorities improve over time to prevent starvation.
+    // Aging reduces priority by 1 every 'agingInterval' time units waited.
+    // Tie-breaking: earlier arrival time, then smaller burst time.
+    static vector<ExecutionSegment> PriorityScheduling(vector<Process>& processes, bool withAging = true) {
+        vector<ExecutionSegment> execution;
+        vector<bool> processed(processes.size(), false); // Track completed processes
+        int currentTime = 0; // Current simulation time
+        int completed = 0; // Number of processes completed
+        // Aging parameters: every `agingInterval` time units a waiting process's
+        // numeric priority is reduced by 1 (improves its priority since lower
+        // number means higher priority). This prevents starvation of low-priority
+        // processes.
+        const int agingInterval = 5; // time units per priority improvement
+
+        // Continue until all processes are completed
+        while (completed < processes.size()) {
+            int highest = -1; // Index of the highest priority process
+            int highestPriority = INT_MAX; // Effective priority of the selected process
+
+            // Find the process with the highest priority (lowest effective priority number)
+            for (int i = 0; i < processes.size(); i++) {
+                if (processed[i]) continue; // Skip already processed
+                int at = processes[i].getArrivalTime();
+                if (at > currentTime) continue; // Not arrived yet
+
+                // Compute effective priority with aging if enabled
+                int effectivePriority;
+                if (withAging) {
+                    int waitTime = currentTime - at; // Time spent waiting
+                    int priorityDrop = waitTime / agingInterval; // Integer division for aging steps
+                    effectivePriority = processes[i].getPriority() - priorityDrop;
+                    if (effectivePriority < 0) effectivePriority = 0; // Clamp to prevent negative
+                } else {
+                    effectivePriority = processes[i].getPriority(); // No aging
+                }
+
+                // Select the process with the lowest effective priority value
+                if (effectivePriority < highestPriority) {
+                    highest = i;
+                    highestPriority = effectivePriority;
+                } else if (effectivePriority == highestPriority) {
+                    // Tie-breaker: earlier arrival wins
+                    if (at < processes[highest].getArrivalTime()) {
+                        highest = i;
+                    } else if (at == processes[highest].getArrivalTime() &&
+                               processes[i].getBurstTime() < processes[highest].getBurstTime()) {
+                        // If same arrival, smaller burst wins
+                        highest = i;
+                    }
+                }
+            }
+
+            // If no process is ready, advance time to the next arrival
+            if (highest == -1) {
+                int nextArrival = INT_MAX;
+                for (int i = 0; i < processes.size(); i++) {
+                    if (!processed[i]) nextArrival = min(nextArrival, processes[i].getArrivalTime());
+                }
+                currentTime = nextArrival;
+                continue; // Restart the loop with new time
+            }
+
+            // Execute the selected process to completion
+            processed[highest] = true;
+            int startTime = currentTime;
+            currentTime += processes[highest].getBurstTime();
+            processes[highest].resetRunStats();
+            processes[highest].recordDispatch(startTime);
+            processes[highest].setCompletionTime(currentTime);
+            processes[highest].calculateTurnaroundTime();
+            processes[highest].calculateWaitingTime();
+            processes[highest].calculateResponseTime();
+
+            execution.push_back({processes[highest].getPID(), startTime, currentTime});
+            completed++;
+        }
+
+        return execution;
+    }
+
+    // Priority Scheduling - Event-driven engine (Non-preemptive)
+    // Produces exactly the same schedule as PriorityScheduling() above, which is kept as the
+    // reference implementation. Arrived processes live in an AgingReadyQueue, which indexes
+    // them so the best effective priority is found without recomputing the aging of every
+    // waiting process: O(log n) per dispatch.
+    template <class Sink>
+    static void PriorityEventDriven(Workload& workload, Sink& sink, bool withAging = true,
+                                    int agingInterval = 5) {
+        int n = workload.size();
+        workload.reset();
+
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        AgingReadyQueue ready(workload.arrival, workload.burst, withAging ? agingInterval : 0);
+        int nextArrival = 0; // Position in byArrival of the next process to admit
+        int currentTime = 0;
+
+        for (int completed = 0; completed < n; completed++) {
+            // If no process is ready, advance time to the next arrival
+            if (ready.empty() && workload.arrival[byArrival[nextArrival]] > currentTime) {
+                currentTime = workload.arrival[byArrival[nextArrival]];
+            }
+            // Admit every process that has arrived by the current time; aging counts
+            // from the arrival time
+            while (nextArrival < n &&
+                   workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                int i = byArrival[nextArrival++];
+                ready.push(i, workload.priority[i], workload.arrival[i]);
+            }
+
+            // Execute the selected process to completion
+            int highest = ready.pop(currentTime);
+            int startTime = currentTime;
+            currentTime += workload.burst[highest];
+            workload.complete(highest, currentTime);
+
+            workload.dispatch(highest, startTime);
+            sink.push(ExecutionSegment(workload.pid[highest], startTime, currentTime));
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> PriorityEventDriven(Workload& workload, bool withAging = true,
+                                                        int agingInterval = 5) {
+        VectorSink sink;
+        PriorityEventDriven(workload, sink, withAging, agingInterval);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> PriorityEventDriven(vector<Process>& processes, bool withAging = true,
+                                                        int agingInterval = 5) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = PriorityEventDriven(workload, withAging, agingInterval);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // SRTF - Shortest Remaining Time First (Preemptive SJF)
+    // Ready processes sit in an indexed min-heap keyed on (remaining time, arrival, index).
+    // The schedule only changes at arrivals and completions, so the running process is
+    // advanced straight to the next of those events and compared against the best waiter;
+    // a newcomer preempts only with a strictly shorter remaining time. Cost is O(n log n).
+    template <class Sink>
+    static void SRTF(Workload& workload, Sink& sink) {
+        typedef tuple<int, int, int> RemainingKey; // (remaining time, arrival time, index)
+        int n = workload.size();
+
+        workload.reset();
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        IndexedMinHeap<RemainingKey> ready(n);
+        int nextArrival = 0; // Position in byArrival of the next process to admit
+        int currentTime = 0;
+        int running = -1;    // Index of the process on the CPU, -1 when idle
+        int startTime = 0;   // Start of the running process's current segment
+        int completed = 0;
+
+        while (completed < n) {
+            if (running == -1) {
+                // Idle CPU: jump to the next arrival if nothing is ready
+                if (ready.empty() && workload.arrival[byArrival[nextArrival]] > currentTime) {
+                    currentTime = workload.arrival[byArrival[nextArrival]];
+                }
+                while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                    int i = byArrival[nextArrival++];
+                    ready.push(i, RemainingKey(workload.remaining[i], workload.arrival[i], i));
+                }
+                running = ready.pop();
+                startTime = currentTime;
+            }
+
+            long long finishTime = (long long)currentTime + workload.remaining[running];
+            if (nextArrival < n && workload.arrival[byArrival[nextArrival]] < finishTime) {
+                // Run until the next arrival, then admit everything arriving at that instant
+                int arrivalTime = workload.arrival[byArrival[nextArrival]];
+                workload.remaining[running] -= arrivalTime - currentTime;
+                currentTime = arrivalTime;
+                while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                    int i = byArrival[nextArrival++];
+                    ready.push(i, RemainingKey(workload.remaining[i], workload.arrival[i], i));
+                }
+
+                // Preempt if a waiting process now needs strictly less time
+                if (get<0>(ready.topKey()) < workload.remaining[running]) {
+                    workload.dispatch(running, startTime);
+                    sink.push(ExecutionSegment(workload.pid[running], startTime, currentTime));
+                    ready.push(running, RemainingKey(workload.remaining[running],
+                                                     workload.arrival[running], running));
+                    running = ready.pop();
+                    startTime = currentTime;
+                }
+            } else {
+                // The running process completes before anything else arrives
+                currentTime = (int)finishTime;
+                workload.remaining[running] = 0;
+                workload.complete(running, currentTime);
+                workload.dispatch(running, startTime);
+                sink.push(ExecutionSegment(workload.pid[running], startTime, currentTime));
+                running = -1;
+                completed++;
+            }
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> SRTF(Workload& workload) {
+        VectorSink sink;
+        SRTF(workload, sink);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> SRTF(vector<Process>& processes) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = SRTF(workload);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // Priority Scheduling - Preemptive, with optional aging
+    // A newly arrived process preempts the running one when its priority is strictly better.
+    // With aging, waiting processes improve by 1 every `agingInterval` time units spent in the
+    // ready queue (counted from arrival, or from the moment they were preempted), while the
+    // running process keeps the effective priority it was dispatched with and carries it back
+    // into the queue when preempted. The time at which some waiter ages below the running
+    // process is computed from the AgingReadyQueue, so the schedule is only re-evaluated at
+    // arrivals, completions and those aging boundaries - never per time unit. Each event
+    // costs O(log n), whatever the aging interval.
+    template <class Sink>
+    static void PriorityPreemptive(Workload& workload, Sink& sink, bool withAging = true,
+                                   int agingInterval = 5) {
+        int n = workload.size();
+
+        workload.reset();
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        AgingReadyQueue ready(workload.arrival, workload.burst, withAging ? agingInterval : 0);
+        int nextArrival = 0;  // Position in byArrival of the next process to admit
+        int currentTime = 0;
+        int running = -1;     // Index of the process on the CPU, -1 when idle
+        int runningLevel = 0; // Effective priority the running process was dispatched with
+        int startTime = 0;    // Start of the running process's current segment
+        int completed = 0;
+
+        while (completed < n) {
+            if (running == -1) {
+                // Idle CPU: jump to the next arrival if nothing is ready
+                if (ready.empty() && workload.arrival[byArrival[nextArrival]] > currentTime) {
+                    currentTime = workload.arrival[byArrival[nextArrival]];
+                }
+                while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                    int i = byArrival[nextArrival++];
+                    ready.push(i, workload.priority[i], workload.arrival[i]);
+                }
+                running = ready.pop(currentTime, &runningLevel);
+                startTime = currentTime;
+            }
+
+            // Next event: completion, next arrival, or a waiter aging past the running process
+            long long finishTime = (long long)currentTime + workload.remaining[running];
+            long long eventTime = ready.nextTimeBelow(runningLevel);
+            if (nextArrival < n) {
+                eventTime = min(eventTime, (long long)workload.arrival[byArrival[nextArrival]]);
+            }
+
+            if (eventTime < finishTime) {
+                int elapsed = (int)(eventTime - currentTime);
+                workload.remaining[running] -= elapsed;
+                currentTime = (int)eventTime;
+                while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                    int i = byArrival[nextArrival++];
+                    ready.push(i, workload.priority[i], workload.arrival[i]);
+                }
+
+                // Preempt if the best waiter is now strictly better than the running process
+                int bestLevel;
+                ready.top(currentTime, &bestLevel);
+                if (bestLevel < runningLevel) {
+                    workload.dispatch(running, startTime);
+                    sink.push(ExecutionSegment(workload.pid[running], startTime, currentTime));
+                    ready.push(running, runningLevel, currentTime);
+                    running = ready.pop(currentTime, &runningLevel);
+                    startTime = currentTime;
+                }
+            } else {
+                // The running process completes before the next event
+                currentTime = (int)finishTime;
+                workload.remaining[running] = 0;
+                workload.complete(running, currentTime);
+                workload.dispatch(running, startTime);
+                sink.push(ExecutionSegment(workload.pid[running], startTime, currentTime));
+                running = -1;
+                completed++;
+            }
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> PriorityPreemptive(Workload& workload, bool withAging = true,
+                                                       int agingInterval = 5) {
+        VectorSink sink;
+        PriorityPreemptive(workload, sink, withAging, agingInterval);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> PriorityPreemptive(vector<Process>& processes, bool withAging = true,
+                                                       int agingInterval = 5) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = PriorityPreemptive(workload, withAging, agingInterval);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // CFS - Completely Fair Scheduler (Linux-style, vruntime based)
+    // Runnable processes are kept in a balanced tree (std::set) ordered by virtual runtime;
+    // the leftmost one runs next. Virtual runtime advances by the time run scaled by
+    // nice-0 weight / process weight, with the weight taken from niceToWeight(priority).
+    // A dispatched process gets the slice period * weight / total weight, where the period
+    // is `targetLatency`, stretched to nr_running * `minGranularity` when too many processes
+    // share it, and never less than `minGranularity`. New processes are placed at the queue's
+    // min_vruntime. Slice ends are computed rather than ticked and a process alone on the CPU
+    // has its slices up to the next arrival merged, so cost is O((n + slices) log n).
+    // Arrivals join the tree immediately but do not preempt (no wakeup preemption).
+    template <class Sink>
+    static void CFS(Workload& workload, Sink& sink, int targetLatency = 24,
+                    int minGranularity = 3) {
+        // Virtual runtime is kept in 1/1024 units of nice-0 time to limit rounding:
+        // running for `t` adds t * VRUNTIME_SCALE / weight (nice-0 weight is 1024)
+        const long long VRUNTIME_SCALE = 1024LL * 1024;
+        typedef pair<long long, int> TreeKey; // (vruntime, index)
+        int n = workload.size();
+        vector<long long> vruntime(n, 0);
+        vector<int> weight(n);
+        workload.reset();
+        for (int i = 0; i < n; i++) weight[i] = niceToWeight(workload.priority[i]);
+        if (minGranularity < 1) minGranularity = 1;
+        if (targetLatency < minGranularity) targetLatency = minGranularity;
+
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        set<TreeKey> tree;          // Runnable processes except the running one
+        long long totalWeight = 0;  // Weight of every runnable process, running one included
+        long long minVruntime = 0;  // Monotonic floor used to place new processes
+        int nextArrival = 0;        // Position in byArrival of the next process to admit
+        int currentTime = 0;
+        int completed = 0;
+
+        while (completed < n) {
+            // Idle CPU: jump to the next arrival
+            if (tree.empty() && workload.arrival[byArrival[nextArrival]] > currentTime) {
+                currentTime = workload.arrival[byArrival[nextArrival]];
+            }
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                int i = byArrival[nextArrival++];
+                vruntime[i] = max(vruntime[i], minVruntime);
+                tree.insert(TreeKey(vruntime[i], i));
+                totalWeight += weight[i];
+            }
+
+            // Pick the leftmost process and compute its slice
+            int idx = tree.begin()->second;
+            tree.erase(tree.begin());
+            long long nrRunning = tree.size() + 1;
+            long long period = targetLatency;
+            if (nrRunning * minGranularity > period) period = nrRunning * minGranularity;
+            long long runTime = max((long long)minGranularity, period * weight[idx] / totalWeight);
+
+            long long upcomingArrival = nextArrival < n ? workload.arrival[byArrival[nextArrival]] : LLONG_MAX;
+            if (tree.empty()) {
+                // Alone: it would be picked again at every slice end until someone arrives
+                if (upcomingArrival == LLONG_MAX) {
+                    runTime = workload.remaining[idx];
+                } else {
+                    long long gap = upcomingArrival - currentTime;
+                    runTime *= max(1LL, (gap + runTime - 1) / runTime);
+                }
+            }
+            if (runTime > workload.remaining[idx]) runTime = workload.remaining[idx];
+            long long endTime = currentTime + runTime;
+
+            // Place processes arriving during the slice at min_vruntime as of their arrival
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= endTime) {
+                int i = byArrival[nextArrival++];
+                long long elapsed = workload.arrival[i] - currentTime;
+                long long runningVruntime = vruntime[idx] + elapsed * VRUNTIME_SCALE / weight[idx];
+                long long leftmost = tree.empty() ? runningVruntime : min(runningVruntime, tree.begin()->first);
+                minVruntime = max(minVruntime, leftmost);
+                vruntime[i] = max(vruntime[i], minVruntime);
+                tree.insert(TreeKey(vruntime[i], i));
+                totalWeight += weight[i];
+            }
+
+            int startTime = currentTime;
+            currentTime = (int)endTime;
+            workload.remaining[idx] -= (int)runTime;
+            vruntime[idx] += runTime * VRUNTIME_SCALE / weight[idx];
+            workload.dispatch(idx, startTime);
+            sink.push(ExecutionSegment(workload.pid[idx], startTime, currentTime));
+
+            if (workload.remaining[idx] > 0) {
+                minVruntime = max(minVruntime, tree.empty() ? vruntime[idx] : min(vruntime[idx], tree.begin()->first));
+                tree.insert(TreeKey(vruntime[idx], idx));
+            } else {
+                if (!tree.empty()) minVruntime = max(minVruntime, tree.begin()->first);
+                totalWeight -= weight[idx];
+                workload.complete(idx, currentTime);
+                completed++;
+            }
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> CFS(Workload& workload, int targetLatency = 24,
+                                        int minGranularity = 3) {
+        VectorSink sink;
+        CFS(workload, sink, targetLatency, minGranularity);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> CFS(vector<Process>& processes, int targetLatency = 24,
+                                        int minGranularity = 3) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = CFS(workload, targetLatency, minGranularity);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // EEVDF - Earliest Eligible Virtual Deadline First (Linux 6.6+ fair scheduler)
+    // Every runnable process has a vruntime (advancing by time run * nice-0 weight / weight,
+    // weight from niceToWeight(priority)) and a virtual deadline vruntime + baseSlice scaled
+    // the same way. A process is eligible when its vruntime is not ahead of V, the
+    // weight-averaged vruntime of all runnable processes (non-negative lag). The eligible
+    // process with the earliest deadline runs for one slice; the EligibilityTree answers that
+    // query in O(log n). New processes are placed at V (zero lag). Like Linux's RUN_TO_PARITY
+    // a running slice is not cut short by arrivals, and a process alone on the CPU has its
+    // slices up to the next arrival merged into one segment.
+    template <class Sink>
+    static void EEVDF(Workload& workload, Sink& sink, int baseSlice = 3) {
+        // Virtual time is kept in 1/1024 units of nice-0 time, as in CFS()
+        const long long VRUNTIME_SCALE = 1024LL * 1024;
+        int n = workload.size();
+        vector<long long> vruntime(n, 0);
+        vector<long long> deadline(n, 0);
+        vector<int> weight(n);
+        workload.reset();
+        for (int i = 0; i < n; i++) weight[i] = niceToWeight(workload.priority[i]);
+        if (baseSlice < 1) baseSlice = 1;
+
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&workload](int a, int b) {
+                        return workload.arrival[a] < workload.arrival[b];
+                    });
+
+        // V is kept as zeroVruntime + weightedSum / totalWeight over the queued processes, with
+        // vruntimes taken relative to zeroVruntime (rebased to the minimum at every dispatch)
+        // so the weighted sum stays small
+        EligibilityTree tree(n);
+        long long zeroVruntime = 0;
+        long long weightedSum = 0;
+        long long totalWeight = 0;
+        long long lastAverage = 0; // V when the queue last emptied, used to place arrivals
+
+        int nextArrival = 0; // Position in byArrival of the next process to admit
+        int currentTime = 0;
+        int completed = 0;
+
+        while (completed < n) {
+            // Idle CPU: jump to the next arrival
+            if (tree.empty() && workload.arrival[byArrival[nextArrival]] > currentTime) {
+                currentTime = workload.arrival[byArrival[nextArrival]];
+            }
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= currentTime) {
+                int i = byArrival[nextArrival++];
+                long long average = totalWeight ? zeroVruntime + floorDiv(weightedSum, totalWeight) : lastAverage;
+                vruntime[i] = average;
+                deadline[i] = average + baseSlice * VRUNTIME_SCALE / weight[i];
+                tree.insert(i, vruntime[i], deadline[i]);
+                weightedSum += (vruntime[i] - zeroVruntime) * weight[i];
+                totalWeight += weight[i];
+            }
+
+            // Rebase the weighted sum on the smallest vruntime, then pick the eligible
+            // process with the earliest virtual deadline
+            long long newZero = tree.minVruntime();
+            weightedSum -= (newZero - zeroVruntime) * totalWeight;
+            zeroVruntime = newZero;
+            long long average = zeroVruntime + floorDiv(weightedSum, totalWeight);
+            int idx = tree.earliestEligible(average);
+            tree.erase(idx);
+            weightedSum -= (vruntime[idx] - zeroVruntime) * weight[idx];
+            totalWeight -= weight[idx];
+
+            long long runTime = baseSlice;
+            long long upcomingArrival = nextArrival < n ? workload.arrival[byArrival[nextArrival]] : LLONG_MAX;
+            if (tree.empty()) {
+                // Alone: it would be picked again at every slice end until someone arrives
+                if (upcomingArrival == LLONG_MAX) {
+                    runTime = workload.remaining[idx];
+                } else {
+                    long long gap = upcomingArrival - currentTime;
+                    runTime *= max(1LL, (gap + runTime - 1) / runTime);
+                }
+            }
+            if (runTime > workload.remaining[idx]) runTime = workload.remaining[idx];
+            long long endTime = currentTime + runTime;
+
+            // Place processes arriving during the slice at V as of their arrival, counting
+            // the running process's progress so far
+            while (nextArrival < n && workload.arrival[byArrival[nextArrival]] <= endTime) {
+                int i = byArrival[nextArrival++];
+                long long elapsed = workload.arrival[i] - currentTime;
+                long long runningVruntime = vruntime[idx] + elapsed * VRUNTIME_SCALE / weight[idx];
+                long long sum = weightedSum + (runningVruntime - zeroVruntime) * weight[idx];
+                long long arrivalAverage = zeroVruntime + floorDiv(sum, totalWeight + weight[idx]);
+                vruntime[i] = arrivalAverage;
+                deadline[i] = arrivalAverage + baseSlice * VRUNTIME_SCALE / weight[i];
+                tree.insert(i, vruntime[i], deadline[i]);
+                weightedSum += (vruntime[i] - zeroVruntime) * weight[i];
+                totalWeight += weight[i];
+            }
+
+            int startTime = currentTime;
+            currentTime = (int)endTime;
+            workload.remaining[idx] -= (int)runTime;
+            vruntime[idx] += runTime * VRUNTIME_SCALE / weight[idx];
+            workload.dispatch(idx, startTime);
+            sink.push(ExecutionSegment(workload.pid[idx], startTime, currentTime));
+
+            if (workload.remaining[idx] > 0) {
+                // Slice used up: issue the next request
+                deadline[idx] = vruntime[idx] + baseSlice * VRUNTIME_SCALE / weight[idx];
+                tree.insert(idx, vruntime[idx], deadline[idx]);
+                weightedSum += (vruntime[idx] - zeroVruntime) * weight[idx];
+                totalWeight += weight[idx];
+            } else {
+                if (totalWeight == 0) lastAverage = vruntime[idx];
+                workload.complete(idx, currentTime);
+                completed++;
+            }
+        }
+    }
+
+    // Same as above, collecting the segments in a vector
+    static vector<ExecutionSegment> EEVDF(Workload& workload, int baseSlice = 3) {
+        VectorSink sink;
+        EEVDF(workload, sink, baseSlice);
+        return move(sink.segments);
+    }
+
+    // Same as above for a vector<Process>: results are stored back into `processes`
+    static vector<ExecutionSegment> EEVDF(vector<Process>& processes, int baseSlice = 3) {
+        Workload workload(processes);
+        vector<ExecutionSegment> execution = EEVDF(workload, baseSlice);
+        workload.storeResults(processes);
+        return execution;
+    }
+
+    // Multi-core (SMP) simulation with per-core run queues
+    // Each process is placed on one of `cores` cores by the placement policy (in arrival
+    // order) and stays there; every core then runs the given single-core policy over its
+    // own run queue, and the resulting segments are tagged with the core ID. Cost is the
+    // placement (O(log cores) per process for the built-in policies) plus the per-core
+    // engines, independent of the number of time units. On return `processes` holds the
+    // processes grouped by core and the segments are grouped by core as well.
+    static vector<ExecutionSegment> MultiCore(vector<Process>& processes, int cores,
+                                              PlacementPolicy& placement, const CoreEngine& engine) {
+        int n = processes.size();
+        vector<ExecutionSegment> execution;
+        execution.reserve(n);
+
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&processes](int a, int b) {
+                        return processes[a].getArrivalTime() < processes[b].getArrivalTime();
+                    });
+
+        // Build each core's run queue
+        vector<vector<Process> > runQueues(cores);
+        placement.reset(cores);
+        for (int k = 0; k < n; k++) {
+            const Process& p = processes[byArrival[k]];
+            runQueues[placement.place(p)].push_back(p);
+        }
+
+        // Run the policy on every core and collect the results
+        processes.clear();
+        for (int c = 0; c < cores; c++) {
+            if (runQueues[c].empty()) continue;
+            vector<ExecutionSegment> coreExecution = engine(runQueues[c]);
+            for (auto& seg : coreExecution) {
+                seg.coreID = c;
+                execution.push_back(seg);
+            }
+            processes.insert(processes.end(), runQueues[c].begin(), runQueues[c].end());
+        }
+
+        return execution;
+    }
+
+    // Multi-core with work stealing
+    // Same per-core run queues as above, but every core runs the non-preemptive policy
+    // `order` on a shared clock, so an idle core with an empty queue can steal from another
+    // core's queue according to `policy`. A steal takes the processes that would run last on
+    // the victim (the back of its queue in `order`). Idle cores retry (up to
+    // `attemptsPerEvent` victims each) when arrivals are left waiting in a run queue, one
+    // idle core per waiting arrival. The simulation is driven by arrival and completion events, so it never scans
+    // cores per time unit; each queue operation is O(log n). Preemptive policies and aging
+    // are not offered, because preemption and aging reorder a queue while its processes
+    // wait. STEAL_NONE gives the same schedule as the engine-based MultiCore() with FCFS, SJF
+    // or Priority without aging, which is the baseline to compare makespan and turnaround
+    // against (except that SJF here runs the shortest of several processes arriving together
+    // at an idle core, where SJF() runs the first one).
+    static vector<ExecutionSegment> MultiCore(vector<Process>& processes, int cores,
+                                              PlacementPolicy& placement, CoreQueueOrder order,
+                                              StealPolicy policy, WorkStealingStats* stats = nullptr,
+                                              unsigned seed = 1, int attemptsPerEvent = 4) {
+        typedef pair<long long, int> CoreEvent;     // (completion time, core)
+        typedef tuple<int, int, int, int> QueueKey; // (level, arrival, burst, arrival rank)
+        int n = processes.size();
+        vector<ExecutionSegment> execution;
+        execution.reserve(n);
+        WorkStealingStats counters;
+        mt19937 rng(seed);
+
+        vector<int> byArrival(n);
+        for (int i = 0; i < n; i++) byArrival[i] = i;
+        stable_sort(byArrival.begin(), byArrival.end(),
+                    [&processes](int a, int b) {
+                        return processes[a].getArrivalTime() < processes[b].getArrivalTime();
+                    });
+
+        // Position in each core's queue; the arrival rank breaks the remaining ties the way
+        // the single-core engines break them on their arrival-ordered input
+        auto queueKey = [&](int rank) {
+            const Process& p = processes[byArrival[rank]];
+            switch (order) {
+                case CORE_SJF: return QueueKey(p.getBurstTime(), 0, 0, rank);
+                case CORE_PRIORITY: return QueueKey(p.getPriority(), p.getArrivalTime(), p.getBurstTime(), rank);
+                default: return QueueKey(0, 0, 0, rank);
+            }
+        };
+
+        vector<set<QueueKey> > runQueues(cores);
+        vector<int> running(cores, -1);
+        vector<int> idleCores;           // Cores with nothing running
+        vector<int> idlePosition(cores); // Position of each core in idleCores, -1 when busy
+        for (int c = 0; c < cores; c++) {
+            idlePosition[c] = c;
+            idleCores.push_back(c);
+        }
+        priority_queue<CoreEvent, vector<CoreEvent>, greater<CoreEvent> > completions;
+        long long queuedTotal = 0; // Processes waiting in any run queue
+        placement.reset(cores);
+
+        // Moves processes from the back of victim's queue to the thief's queue
+        auto steal = [&](int thief, int victim) {
+            int amount = runQueues[victim].size();
+            if (amount == 0) return false;
+            if (policy != STEAL_RANDOM) amount = (amount + 1) / 2; else amount = 1;
+            for (int k = 0; k < amount; k++) {
+                auto last = prev(runQueues[victim].end());
+                counters.migratedWork += processes[byArrival[get<3>(*last)]].getBurstTime();
+                runQueues[thief].insert(*last);
+                runQueues[victim].erase(last);
+            }
+            counters.successfulSteals++;
+            counters.migratedProcesses += amount;
+            return true;
+        };
+
+        // Starts the next process of an idle core, stealing first if its queue is empty
+        auto dispatch = [&](int core, long long now) {
+            if (runQueues[core].empty() && policy != STEAL_NONE && cores > 1) {
+                for (int attempt = 0; attempt < attemptsPerEvent && queuedTotal > 0; attempt++) {
+                    counters.stealAttempts++;
+                    int victim = rng() % (cores - 1);
+                    if (victim >= core) victim++;
+                    if (policy == STEAL_POWER_OF_TWO) {
+                        int other = rng() % (cores - 1);
+                        if (other >= core) other++;
+                        if (runQueues[other].size() > runQueues[victim].size()) victim = other;
+                    }
+                    if (steal(core, victim)) break;
+                }
+            }
+            if (runQueues[core].empty()) return;
+
+            int i = byArrival[get<3>(*runQueues[core].begin())];
+            runQueues[core].erase(runQueues[core].begin());
+            queuedTotal--;
+            running[core] = i;
+            int pos = idlePosition[core];
+            idlePosition[idleCores.back()] = pos;
+            swap(idleCores[pos], idleCores.back());
+            idleCores.pop_back();
+            idlePosition[core] = -1;
+
+            int startTime = (int)now;
+            int endTime = startTime + processes[i].getBurstTime();
+            processes[i].resetRunStats();
+            processes[i].recordDispatch(startTime);
+            processes[i].setCompletionTime(endTime);
+            processes[i].calculateTurnaroundTime();
+            processes[i].calculateWaitingTime();
+            processes[i].calculateResponseTime();
+            execution.push_back({processes[i].getPID(), startTime, endTime, core});
+            completions.push(CoreEvent(endTime, core));
+        };
+
+        int nextArrival = 0; // Position in byArrival of the next process to admit
+        int completed = 0;
+        vector<int> woken;    // Cores that freed up or received work at this event time
+        vector<int> enqueued; // Cores that received an arrival at this event time
+        while (completed < n) {
+            long long now = LLONG_MAX;
+            if (!completions.empty()) now = completions.top().first;
+            if (nextArrival < n) now = min(now, (long long)processes[byArrival[nextArrival]].getArrivalTime());
+
+            // Completions first, then arrivals, then dispatch on the affected cores
+            woken.clear();
+            while (!completions.empty() && completions.top().first == now) {
+                int core = completions.top().second;
+                completions.pop();
+                running[core] = -1;
+                idlePosition[core] = idleCores.size();
+                idleCores.push_back(core);
+                woken.push_back(core);
+                completed++;
+            }
+            enqueued.clear();
+            while (nextArrival < n && processes[byArrival[nextArrival]].getArrivalTime() == now) {
+                int rank = nextArrival++;
+                int core = placement.place(processes[byArrival[rank]]);
+                runQueues[core].insert(queueKey(rank));
+                queuedTotal++;
+                enqueued.push_back(core);
+                if (running[core] == -1) woken.push_back(core);
+            }
+            for (int core : woken) {
+                if (running[core] == -1) dispatch(core, now);
+            }
+
+            // Idle cores retry stealing only when arrivals are left waiting in a queue (other
+            // events give them nothing new to steal), one idle core per waiting arrival. Walked
+            // backwards because a core that starts work is swapped with the last idle core.
+            int stealable = 0;
+            for (int core : enqueued) stealable += !runQueues[core].empty();
+            if (policy != STEAL_NONE) {
+                for (int k = (int)idleCores.size() - 1; k >= 0 && stealable > 0 && queuedTotal > 0; k--, stealable--) {
+                    dispatch(idleCores[k], now);
+                }
+            }
+        }
+
+        if (stats) *stats = counters;
+        return execution;
+    }
+
+    // Busy-period sharding for non-preemptive policies
+    // A work-conserving non-preemptive schedule splits into busy periods separated by idle
+    // gaps, and which processes share a busy period does not depend on the policy: a cheap
+    // scan over the arrival-sorted processes (end = max(end, arrival) + burst) finds them.
+    // Consecutive busy periods are grouped into shards of similar size, each shard is run
+    // through `engine` (FCFS, SJFEventDriven or PriorityEventDriven) on a worker thread, and
+    // the segments are stitched back in time order. The result matches running `engine` once
+    // over the processes in arrival order (FCFS's unstable sort aside, which may order equal
+    // arrival times differently). `threads` = 0 uses every hardware thread. On
+    // return `processes` is sorted by arrival within each shard, in the order the engine
+    // left them.
+    static vector<ExecutionSegment> BusyPeriodSharded(vector<Process>& processes, const CoreEngine& engine,
+                                                      int threads = 0) {
+        int n = processes.size();
+        if (threads <= 0) threads = defaultThreadCount();
+
+        stable_sort(processes.begin(), processes.end(),
+                    [](const Process& a, const Process& b) {
+                        return a.getArrivalTime() < b.getArrivalTime();
+                    });
+
+        // Cut shards at idle gaps once a shard holds at least its share of the processes
+        // (a process arriving exactly when the CPU frees up stays in the same busy period)
+        long long targetSize = max(1LL, (long long)n / (threads * 8LL));
+        vector<int> shardBegin;
+        long long busyUntil = 0;
+        for (int i = 0; i < n; i++) {
+            if (i == 0 || (processes[i].getArrivalTime() > busyUntil &&
+                           i - shardBegin.back() >= targetSize)) {
+                shardBegin.push_back(i);
+            }
+            busyUntil = max(busyUntil, (long long)processes[i].getArrivalTime()) + processes[i].getBurstTime();
+        }
+        shardBegin.push_back(n);
+        int shards = shardBegin.size() - 1;
+
+        // Workers take shards in order from a shared counter
+        vector<vector<ExecutionSegment> > shardExecution(max(shards, 0));
+        atomic<int> nextShard(0);
+        runOnThreads(min(threads, max(shards, 1)), [&](int) {
+            for (int k = nextShard++; k < shards; k = nextShard++) {
+                vector<Process> shard(processes.begin() + shardBegin[k], processes.begin() + shardBegin[k + 1]);
+                shardExecution[k] = engine(shard);
+                copy(shard.begin(), shard.end(), processes.begin() + shardBegin[k]);
+            }
+        });
+
+        // Stitch the segments together
+        vector<ExecutionSegment> execution;
+        size_t total = 0;
+        for (const auto& part : shardExecution) total += part.size();
+        execution.reserve(total);
+        for (const auto& part : shardExecution) execution.insert(execution.end(), part.begin(), part.end());
+        return execution;
+    }
+};
+
+// Sum, minimum, maximum and sum of squares of one metric column
+struct MetricSummary {
+    long long count;
+    long long sum;
+    int minValue;
+    int maxValue;
+    double sumSquares;
+
+    MetricSummary() : count(0), sum(0), minValue(0), maxValue(0), sumSquares(0) {}
+
+    double mean() const { return count ? (double)sum / count : 0; }
+
+    // Population standard deviation
+    double stddev() const {
+        if (!count) return 0;
+        double m = mean();
+        return sqrt(max(0.0, sumSquares / count - m * m));
+    }
+};
+
+static MetricSummary summarizeColumnScalar(const int* values, size_t n) {
+    MetricSummary summary;
+    if (n == 0) return summary;
+    long long sum = 0;
+    int lo = INT_MAX, hi = INT_MIN;
+    double squares = 0;
+    for (size_t i = 0; i < n; i++) {
+        int v = values[i];
+        sum += v;
+        lo = min(lo, v);
+        hi = max(hi, v);
+        squares += (double)v * v;
+    }
+    summary.count = n;
+    summary.sum = sum;
+    summary.minValue = lo;
+    summary.maxValue = hi;
+    summary.sumSquares = squares;
+    return summary;
+}
+
+#ifdef CPU_SCHEDULER_X86_KERNELS
+// AVX2 version: eight values per iteration, min/max on 32-bit lanes, the sum widened to four
+// 64-bit lanes and the squares accumulated in four doubles. Compiled for AVX2 regardless of
+// the build flags and only called when the CPU reports support for it.
+__attribute__((target("avx2")))
+static MetricSummary summarizeColumnAVX2(const int* values, size_t n) {
+    if (n < 8) return summarizeColumnScalar(values, n);
+    __m256i lo = _mm256_set1_epi32(INT_MAX), hi = _mm256_set1_epi32(INT_MIN);
+    __m256i sum = _mm256_setzero_si256();
+    __m256d squares = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(values + i));
+        lo = _mm256_min_epi32(lo, v);
+        hi = _mm256_max_epi32(hi, v);
+        __m128i low = _mm256_castsi256_si128(v), high = _mm256_extracti128_si256(v, 1);
+        sum = _mm256_add_epi64(sum, _mm256_add_epi64(_mm256_cvtepi32_epi64(low), _mm256_cvtepi32_epi64(high)));
+        __m256d dlow = _mm256_cvtepi32_pd(low), dhigh = _mm256_cvtepi32_pd(high);
+        squares = _mm256_add_pd(squares, _mm256_add_pd(_mm256_mul_pd(dlow, dlow), _mm256_mul_pd(dhigh, dhigh)));
+    }
+
+    alignas(32) int loLanes[8], hiLanes[8];
+    alignas(32) long long sumLanes[4];
+    alignas(32) double squareLanes[4];
+    _mm256_store_si256((__m256i*)loLanes, lo);
+    _mm256_store_si256((__m256i*)hiLanes, hi);
+    _mm256_store_si256((__m256i*)sumLanes, sum);
+    _mm256_store_pd(squareLanes, squares);
+
+    MetricSummary summary = summarizeColumnScalar(values + i, n - i);
+    summary.count = n;
+    if (i == n) {
+        summary.minValue = INT_MAX;
+        summary.maxValue = INT_MIN;
+    }
+    for (int k = 0; k < 8; k++) {
+        summary.minValue = min(summary.minValue, loLanes[k]);
+        summary.maxValue = max(summary.maxValue, hiLanes[k]);
+    }
+    for (int k = 0; k < 4; k++) {
+        summary.sum += sumLanes[k];
+        summary.sumSquares += squareLanes[k];
+    }
+    return summary;
+}
+#endif
+
+// Statistics kernel: picks the AVX2 version when the CPU supports it
+static MetricSummary summarizeColumn(const int* values, size_t n) {
+#ifdef CPU_SCHEDULER_X86_KERNELS
+    static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+    if (hasAVX2) return summarizeColumnAVX2(values, n);
+#endif
+    return summarizeColumnScalar(values, n);
+}
+
+// Per-process metrics of a finished run, one column per metric
+struct ResultColumns {
+    vector<int> completion;
+    vector<int> turnaround;
+    vector<int> waiting;
+    vector<int> response;
+};
+
+ResultColumns collectResults(const Workload& workload) {
+    int n = workload.size();
+    ResultColumns results;
+    results.completion = workload.completion;
+    results.turnaround.resize(n);
+    results.waiting.resize(n);
+    results.response.resize(n);
+    for (int i = 0; i < n; i++) {
+        results.turnaround[i] = workload.turnaroundTime(i);
+        results.waiting[i] = workload.waitingTime(i);
+        results.response[i] = workload.responseTime(i);
+    }
+    return results;
+}
+
+ResultColumns collectResults(const vector<Process>& processes) {
+    int n = processes.size();
+    ResultColumns results;
+    results.completion.resize(n);
+    results.turnaround.resize(n);
+    results.waiting.resize(n);
+    results.response.resize(n);
+    for (int i = 0; i < n; i++) {
+        const Process& p = processes[i];
+        results.completion[i] = p.completionTime;
+        results.turnaround[i] = p.turnaroundTime;
+        results.waiting[i] = p.waitingTime;
+        results.response[i] = p.responseTime;
+    }
+    return results;
+}
+
+struct ScheduleStats {
+    MetricSummary turnaround;
+    MetricSummary waiting;
+    MetricSummary response;
+    CompletionMetrics distribution; // Percentiles of the same three metrics
+    int makespan;      // Latest completion time
+    double throughput; // Processes completed per unit time
+
+    ScheduleStats() : makespan(0), throughput(0) {}
+};
+
+// Histograms of finished results, for runs that did not record them online through
+// Workload::metrics (the reference engines on vector<Process>)
+CompletionMetrics recordMetrics(const ResultColumns& results) {
+    CompletionMetrics metrics;
+    for (size_t i = 0; i < results.completion.size(); i++) {
+        metrics.turnaround.record(results.turnaround[i]);
+        metrics.waiting.record(results.waiting[i]);
+        metrics.response.record(results.response[i]);
+        metrics.makespan = max(metrics.makespan, results.completion[i]);
+    }
+    return metrics;
+}
+
+ScheduleStats computeStats(const ResultColumns& results, const CompletionMetrics& distribution) {
+    ScheduleStats stats;
+    size_t n = results.completion.size();
+    stats.turnaround = summarizeColumn(results.turnaround.data(), n);
+    stats.waiting = summarizeColumn(results.waiting.data(), n);
+    stats.response = summarizeColumn(results.response.data(), n);
+    stats.distribution = distribution;
+    stats.makespan = summarizeColumn(results.completion.data(), n).maxValue;
+    stats.throughput = stats.makespan > 0 ? n / (double)stats.makespan : 0;
+    return stats;
+}
+
+void displayStats(const ScheduleStats& stats) {
+    cout << string(80, '-') << endl;
+    cout << "Average Turnaround Time: " << fixed << setprecision(2) << stats.turnaround.mean() << endl;
+    cout << "Average Waiting Time: " << fixed << setprecision(2) << stats.waiting.mean() << endl;
+    cout << "Average Response Time: " << fixed << setprecision(2) << stats.response.mean() << endl;
+    cout << "Throughput: " << fixed << setprecision(2) << stats.throughput << endl;
+    cout << endl;
+    cout << left << setw(12) << "Metric" << setw(8) << "Min" << setw(8) << "Max"
+         << setw(10) << "Mean" << setw(10) << "Std Dev"
+         << setw(8) << "p50" << setw(8) << "p99" << setw(8) << "p99.9" << endl;
+    const MetricSummary* summaries[] = {&stats.turnaround, &stats.waiting, &stats.response};
+    const LatencyHistogram* histograms[] = {&stats.distribution.turnaround, &stats.distribution.waiting,
+                                            &stats.distribution.response};
+    const char* names[] = {"Turnaround", "Waiting", "Response"};
+    for (int m = 0; m < 3; m++) {
+        cout << left << setw(12) << names[m]
+             << setw(8) << summaries[m]->minValue
+             << setw(8) << summaries[m]->maxValue
+             << setw(10) << summaries[m]->mean()
+             << setw(10) << summaries[m]->stddev()
+             << setw(8) << histograms[m]->percentile(50)
+             << setw(8) << histograms[m]->percentile(99)
+             << setw(8) << histograms[m]->percentile(99.9) << endl;
+    }
+}
+
+void displayResults(const vector<Process>& processes, const string& algorithmName) {
+    // Statistics are computed over result columns first, then printed
+    ResultColumns results = collectResults(processes);
+    ScheduleStats stats = computeStats(results, recordMetrics(results));
+
+    cout << "\n" << string(80, '=') << endl;
+    cout << "Algorithm: " << algorithmName << endl;
+    cout << string(80, '=') << endl;
+    cout << left << setw(6) << "PID" << setw(9) << "Arrival"
+         << setw(7) << "Burst" << setw(12) << "Completion"
+         << setw(12) << "Turnaround" << setw(9) << "Waiting"
+         << setw(10) << "Response" << setw(9) << "Preempt" << "Switches" << endl;
+    cout << string(80, '-') << endl;
+
+    for (const auto& p : processes) {
+        cout << left << setw(6) << p.getPID()
+             << setw(9) << p.getArrivalTime()
+             << setw(7) << p.getBurstTime()
+             << setw(12) << p.completionTime
+             << setw(12) << p.turnaroundTime
+             << setw(9) << p.waitingTime
+             << setw(10) << p.responseTime
+             << setw(9) << p.preemptions
+             << p.contextSwitches << endl;
+    }
+
+    displayStats(stats);
+}
+
+// Renders a Gantt chart into one string. The time axis is scaled so the chart is at most
+// `width` columns wide; each column covers the same number of time units, and segments
+// shorter than a column are aggregated into it (level of detail): '=' means the lane was
+// busy for the whole column, '+' for at least half of it, '.' for less. At most `maxLanes`
+// lanes (lowest PIDs / cores first) are drawn. Cost is O(segments + width x lanes): each
+// segment touches at most two columns directly and marks the columns it spans in a
+// difference array.
+string renderGanttChart(const vector<ExecutionSegment>& execution, GanttLanes lanes = LANES_AUTO,
+                        int width = 64, int maxLanes = 64) {
+    if (execution.empty() || width < 1 || maxLanes < 1) return "";
+    if (lanes == LANES_AUTO) {
+        lanes = LANES_BY_PROCESS;
+        for (const auto& seg : execution) {
+            if (seg.coreID != 0) lanes = LANES_BY_CORE;
+        }
+    }
+    auto laneKey = [lanes](const ExecutionSegment& seg) {
+        return lanes == LANES_BY_CORE ? seg.coreID : seg.processID;
+    };
+
+    // Lanes: the distinct keys in increasing order, capped at maxLanes
+    long long maxTime = 0;
+    unordered_map<int, int> laneOf;
+    vector<int> keys;
+    for (const auto& seg : execution) {
+        maxTime = max(maxTime, (long long)seg.endTime);
+        if (laneOf.insert(make_pair(laneKey(seg), 0)).second) keys.push_back(laneKey(seg));
+    }
+    sort(keys.begin(), keys.end());
+    int laneCount = min((int)keys.size(), maxLanes);
+    for (int l = 0; l < (int)keys.size(); l++) laneOf[keys[l]] = l < laneCount ? l : -1;
+
+    // Time units per column
+    long long scale = max(1LL, (maxTime + width - 1) / width);
+    int columns = (int)max(1LL, (maxTime + scale - 1) / scale);
+
+    // Busy time per lane and column: partial columns are added directly, fully covered runs
+    // of columns go through a difference array
+    vector<long long> busy((size_t)laneCount * columns, 0);
+    vector<long long> fullRuns((size_t)laneCount * (columns + 1), 0);
+    for (const auto& seg : execution) {
+        int lane = laneOf[laneKey(seg)];
+        if (lane < 0 || seg.endTime <= seg.startTime) continue;
+        long long start = max(0, seg.startTime), end = seg.endTime;
+        long long first = start / scale, last = (end - 1) / scale;
+        long long* row = &busy[(size_t)lane * columns];
+        if (first == last) {
+            row[first] += end - start;
+        } else {
+            row[first] += (first + 1) * scale - start;
+            row[last] += end - last * scale;
+            if (first + 1 < last) {
+                fullRuns[(size_t)lane * (columns + 1) + first + 1] += scale;
+                fullRuns[(size_t)lane * (columns + 1) + last] -= scale;
+            }
+        }
+    }
+
+    size_t labelWidth = 6;
+    for (int l = 0; l < laneCount; l++) {
+        string label = (lanes == LANES_BY_CORE ? "Core " : "P") + to_string(keys[l]);
+        labelWidth = max(labelWidth, label.size() + 1);
+    }
+
+    string out;
+    out.reserve((labelWidth + columns + 4) * (laneCount + 4) + 128);
+    out += "Time scale: " + to_string(scale) + (scale == 1 ? " time unit" : " time units") + " per column";
+    out += ", '=' busy, '+' at least half, '.' less\n";
+
+    // Axis with a tick every 10 columns, labelled with the time at the column's left edge
+    string ticks(columns + 1, ' '), labels(columns + 12, ' ');
+    for (int c = 0; c <= columns; c += 10) {
+        ticks[c] = '|';
+        string t = to_string(min(maxTime, c * scale));
+        labels.replace(c, t.size(), t);
+    }
+    labels.erase(labels.find_last_not_of(' ') + 1);
+    ticks.erase(ticks.find_last_not_of(' ') + 1);
+    out += string(labelWidth + 1, ' ') + labels + "\n";
+    out += string(labelWidth + 1, ' ') + ticks + "\n";
+
+    for (int l = 0; l < laneCount; l++) {
+        string label = (lanes == LANES_BY_CORE ? "Core " : "P") + to_string(keys[l]);
+        out += label + string(labelWidth - label.size(), ' ') + "|";
+        long long run = 0;
+        const long long* row = &busy[(size_t)l * columns];
+        const long long* runs = &fullRuns[(size_t)l * (columns + 1)];
+        for (int c = 0; c < columns; c++) {
+            run += runs[c];
+            long long covered = row[c] + run;
+            long long columnLength = min(scale, maxTime - c * scale);
+            if (covered >= columnLength) out += '=';
+            else if (2 * covered >= columnLength) out += '+';
+            else if (covered > 0) out += '.';
+            else out += ' ';
+        }
+        out += "|\n";
+    }
+    if ((int)keys.size() > laneCount) {
+        out += "(" + to_string(keys.size() - laneCount) + " more " +
+               (lanes == LANES_BY_CORE ? "cores" : "processes") + " not shown)\n";
+    }
+    return out;
+}
+
+// Function to display Gantt Chart
+void displayGanttChart(const vector<ExecutionSegment>& segments) {
+    if (segments.empty()) return;
+
+    // Back-to-back time slices of the same process are drawn as one bar
+    vector<ExecutionSegment> execution = coalesceSegments(segments);
+
+    // The whole chart is formatted into one buffer and written at once
+    ostringstream out;
+    out << "\n" << string(80, '=') << "\n";
+    out << "GANTT CHART VISUALIZATION" << "\n";
+    out << string(80, '=') << "\n";
+    out << "Segments: " << segments.size() << " (" << execution.size() << " after coalescing)" << "\n\n";
+    out << renderGanttChart(execution);
+
+    // Display process details (with the core column for multi-core runs); long runs only
+    // list the first segments
+    const size_t MAX_DETAIL_ROWS = 100;
+    bool multiCore = false;
+    for (const auto& seg : execution) {
+        if (seg.coreID != 0) multiCore = true;
+    }
+    out << "\nProcess Execution Details:" << "\n";
+    out << left << setw(10) << "Process" << setw(12) << "Start Time" << setw(12) << "End Time" << setw(12) << "Duration";
+    if (multiCore) out << setw(8) << "Core";
+    out << "\n";
+    out << string(multiCore ? 54 : 46, '-') << "\n";
+
+    for (size_t k = 0; k < execution.size() && k < MAX_DETAIL_ROWS; k++) {
+        const ExecutionSegment& seg = execution[k];
+        out << left << setw(10) << "P" + to_string(seg.processID)
+            << setw(12) << seg.startTime
+            << setw(12) << seg.endTime
+            << setw(12) << (seg.endTime - seg.startTime);
+        if (multiCore) out << setw(8) << seg.coreID;
+        out << "\n";
+    }
+    if (execution.size() > MAX_DETAIL_ROWS) {
+        out << "... " << execution.size() - MAX_DETAIL_ROWS << " more segments" << "\n";
+    }
+    cout << out.str() << flush;
+}
+
+// Function to execute the selected scheduling algorithm
+void executeScheduler(vector<Process>& processes, int choice) {
+    vector<Process> tempProcesses = processes;
+    vector<ExecutionSegment> execution;
+
+    switch (choice) {
+        case 1: {
+            // Execute FCFS algorithm
+            execution = Scheduler::FCFS(tempProcesses);
+            displayResults(tempProcesses, "FCFS");
+            displayGanttChart(execution);
+            break;
+        }
+        case 2: {
+            // Execute SJF algorithm (event-driven engine, same schedule as Scheduler::SJF)
+            execution = Scheduler::SJFEventDriven(tempProcesses);
             displayResults(tempProcesses, "SJF");
             displayGanttChart(execution);
             break;
@@ -425,17 +3157,211 @@ void executeScheduler(vector<Process>& processes, int choice) {
             displayGanttChart(execution);
             break;
         }
-        case 4: {
-            // Execute Priority Scheduling algorithm without aging
-            execution = Scheduler::PriorityScheduling(tempProcesses, false);
-            displayResults(tempProcesses, "Priority Scheduling (without aging)");
+        case 4: {
+            // Execute Priority Scheduling algorithm without aging
+            execution = Scheduler::PriorityEventDriven(tempProcesses, false);
+            displayResults(tempProcesses, "Priority Scheduling (without aging)");
+            displayGanttChart(execution);
+            break;
+        }
+        case 5: {
+            // Execute Priority Scheduling algorithm with aging
+            execution = Scheduler::PriorityEventDriven(tempProcesses, true);
+            displayResults(tempProcesses, "Priority Scheduling (with aging)");
+            displayGanttChart(execution);
+            break;
+        }
+        case 7: {
+            // Execute arrival-aware Round Robin with user-defined time quantum
+            int quantum;
+            cout << "Enter time quantum for Round Robin: ";
+            cin >> quantum;
+            execution = Scheduler::RoundRobinEventDriven(tempProcesses, quantum);
+            displayResults(tempProcesses, "Round Robin, arrival-aware (Quantum = " + to_string(quantum) + ")");
+            displayGanttChart(execution);
+            break;
+        }
+        case 8: {
+            // Execute preemptive Shortest Remaining Time First
+            execution = Scheduler::SRTF(tempProcesses);
+            displayResults(tempProcesses, "SRTF (Shortest Remaining Time First)");
+            displayGanttChart(execution);
+            break;
+        }
+        case 9: {
+            // Execute preemptive Priority Scheduling with aging
+            execution = Scheduler::PriorityPreemptive(tempProcesses, true);
+            displayResults(tempProcesses, "Priority Scheduling (preemptive, with aging)");
+            displayGanttChart(execution);
+            break;
+        }
+        case 10: {
+            // Execute Multi-Level Feedback Queue with user-defined levels and quanta
+            int levels, boostPeriod;
+            cout << "Enter number of MLFQ levels (1-64): ";
+            cin >> levels;
+            if (levels < 1 || levels > 64) {
+                cout << "Invalid number of levels!" << endl;
+                break;
+            }
+            vector<int> levelQuanta(levels);
+            for (int k = 0; k < levels; k++) {
+                cout << "Enter time quantum for level " << k << ": ";
+                cin >> levelQuanta[k];
+            }
+            cout << "Enter priority boost period (0 = no boost): ";
+            cin >> boostPeriod;
+            execution = Scheduler::MLFQ(tempProcesses, levelQuanta, boostPeriod);
+            displayResults(tempProcesses, "MLFQ (" + to_string(levels) + " levels, boost = " + to_string(boostPeriod) + ")");
+            displayGanttChart(execution);
+            break;
+        }
+        case 11: {
+            // Execute the CFS-style fair scheduler with user-defined latency parameters
+            int targetLatency, minGranularity;
+            cout << "Enter CFS target latency: ";
+            cin >> targetLatency;
+            cout << "Enter CFS minimum granularity: ";
+            cin >> minGranularity;
+            execution = Scheduler::CFS(tempProcesses, targetLatency, minGranularity);
+            displayResults(tempProcesses, "CFS (latency = " + to_string(targetLatency) +
+                                          ", granularity = " + to_string(minGranularity) + ")");
+            displayGanttChart(execution);
+            break;
+        }
+        case 12: {
+            // Execute the EEVDF scheduler with a user-defined base slice
+            int baseSlice;
+            cout << "Enter EEVDF base slice: ";
+            cin >> baseSlice;
+            execution = Scheduler::EEVDF(tempProcesses, baseSlice);
+            displayResults(tempProcesses, "EEVDF (base slice = " + to_string(baseSlice) + ")");
+            displayGanttChart(execution);
+            break;
+        }
+        case 13: {
+            // Execute a single-core policy on every core of a simulated multi-core system
+            int cores, placementChoice, policyChoice, quantum = 0;
+            cout << "Enter number of cores: ";
+            cin >> cores;
+            if (cores < 1) {
+                cout << "Invalid number of cores!" << endl;
+                break;
+            }
+            cout << "Placement (1 = round robin, 2 = least loaded, 3 = PID hash): ";
+            cin >> placementChoice;
+            cout << "Per-core policy (1 = FCFS, 2 = SJF, 3 = Round Robin, 4 = Priority): ";
+            cin >> policyChoice;
+            if (policyChoice == 3) {
+                cout << "Enter time quantum for Round Robin: ";
+                cin >> quantum;
+            }
+
+            RoundRobinPlacement roundRobinPlacement;
+            LeastLoadedPlacement leastLoadedPlacement;
+            PidHashPlacement pidHashPlacement;
+            PlacementPolicy* placement = &roundRobinPlacement;
+            if (placementChoice == 2) placement = &leastLoadedPlacement;
+            if (placementChoice == 3) placement = &pidHashPlacement;
+
+            Scheduler::CoreEngine engine;
+            string policyName;
+            switch (policyChoice) {
+                case 2:
+                    engine = [](vector<Process>& p) { return Scheduler::SJFEventDriven(p); };
+                    policyName = "SJF";
+                    break;
+                case 3:
+                    engine = [quantum](vector<Process>& p) { return Scheduler::RoundRobinEventDriven(p, quantum); };
+                    policyName = "Round Robin (Quantum = " + to_string(quantum) + ")";
+                    break;
+                case 4:
+                    engine = [](vector<Process>& p) { return Scheduler::PriorityEventDriven(p, true); };
+                    policyName = "Priority (with aging)";
+                    break;
+                default:
+                    engine = Scheduler::FCFS;
+                    policyName = "FCFS";
+            }
+            execution = Scheduler::MultiCore(tempProcesses, cores, *placement, engine);
+            displayResults(tempProcesses, "Multi-core " + policyName + " (" + to_string(cores) + " cores)");
+            displayGanttChart(execution);
+            break;
+        }
+        case 14: {
+            // Execute a non-preemptive policy on a multi-core system with work-stealing
+            // load balancing
+            int cores, placementChoice, policyChoice, stealChoice;
+            cout << "Enter number of cores: ";
+            cin >> cores;
+            if (cores < 1) {
+                cout << "Invalid number of cores!" << endl;
+                break;
+            }
+            cout << "Placement (1 = round robin, 2 = least loaded, 3 = PID hash): ";
+            cin >> placementChoice;
+            cout << "Per-core policy (1 = FCFS, 2 = SJF, 3 = Priority): ";
+            cin >> policyChoice;
+            cout << "Stealing (0 = none, 1 = random victim, 2 = steal half, 3 = power of two choices): ";
+            cin >> stealChoice;
+
+            RoundRobinPlacement roundRobinPlacement;
+            LeastLoadedPlacement leastLoadedPlacement;
+            PidHashPlacement pidHashPlacement;
+            PlacementPolicy* placement = &roundRobinPlacement;
+            if (placementChoice == 2) placement = &leastLoadedPlacement;
+            if (placementChoice == 3) placement = &pidHashPlacement;
+
+            const CoreQueueOrder orders[] = {CORE_FCFS, CORE_SJF, CORE_PRIORITY};
+            const string orderNames[] = {"FCFS", "SJF", "Priority"};
+            if (policyChoice < 1 || policyChoice > 3) policyChoice = 1;
+            const StealPolicy policies[] = {STEAL_NONE, STEAL_RANDOM, STEAL_HALF, STEAL_POWER_OF_TWO};
+            const string policyNames[] = {"no stealing", "random victim", "steal half", "power of two choices"};
+            if (stealChoice < 0 || stealChoice > 3) stealChoice = 0;
+
+            WorkStealingStats stats;
+            execution = Scheduler::MultiCore(tempProcesses, cores, *placement, orders[policyChoice - 1],
+                                             policies[stealChoice], &stats);
+            displayResults(tempProcesses, "Multi-core " + orderNames[policyChoice - 1] + ", " +
+                                          policyNames[stealChoice] + " (" + to_string(cores) + " cores)");
+
+            int makespan = 0, maxTurnaround = 0;
+            for (const auto& p : tempProcesses) {
+                makespan = max(makespan, p.completionTime);
+                maxTurnaround = max(maxTurnaround, p.turnaroundTime);
+            }
+            cout << "Makespan: " << makespan << endl;
+            cout << "Maximum Turnaround Time: " << maxTurnaround << endl;
+            cout << "Steal Attempts: " << stats.stealAttempts
+                 << ", Successful: " << stats.successfulSteals
+                 << ", Migrated Processes: " << stats.migratedProcesses
+                 << ", Migrated Work: " << stats.migratedWork << endl;
+            displayGanttChart(execution);
+            break;
+        }
+        case 15: {
+            // Execute FCFS with the multi-threaded max-plus prefix scan
+            execution = Scheduler::FCFSParallel(tempProcesses);
+            displayResults(tempProcesses, "FCFS (parallel scan)");
             displayGanttChart(execution);
             break;
         }
-        case 5: {
-            // Execute Priority Scheduling algorithm with aging
-            execution = Scheduler::PriorityScheduling(tempProcesses, true);
-            displayResults(tempProcesses, "Priority Scheduling (with aging)");
+        case 16: {
+            // Execute a non-preemptive policy with its busy periods simulated in parallel
+            int policyChoice;
+            cout << "Policy (1 = FCFS, 2 = SJF, 3 = Priority): ";
+            cin >> policyChoice;
+            Scheduler::CoreEngine engine = Scheduler::FCFS;
+            string policyName = "FCFS";
+            if (policyChoice == 2) {
+                engine = [](vector<Process>& p) { return Scheduler::SJFEventDriven(p); };
+                policyName = "SJF";
+            } else if (policyChoice == 3) {
+                engine = [](vector<Process>& p) { return Scheduler::PriorityEventDriven(p, false); };
+                policyName = "Priority Scheduling";
+            }
+            execution = Scheduler::BusyPeriodSharded(tempProcesses, engine);
+            displayResults(tempProcesses, policyName + " (busy-period sharded)");
             displayGanttChart(execution);
             break;
         }
@@ -444,7 +3370,1278 @@ void executeScheduler(vector<Process>& processes, int choice) {
     }
 }
 
-int main() {
+// ---------------------------------------------------------------------------------------
+// Batch mode: cpuScheduler --algo rr,srtf --quantum 4 --input trace.csv --output results.csv
+// ---------------------------------------------------------------------------------------
+
+// Exit statuses of the batch mode
+enum BatchExitCode {
+    EXIT_BATCH_OK = 0,
+    EXIT_BATCH_USAGE = 2,  // Bad command-line arguments
+    EXIT_BATCH_INPUT = 3,  // Input file missing or malformed
+    EXIT_BATCH_OUTPUT = 4  // Output file could not be written
+};
+
+// Parses an optionally signed decimal int at `p` (stops at `end`), skipping leading blanks.
+// Returns the position after the number, or nullptr if there is none or it overflows.
+static const char* parseIntField(const char* p, const char* end, int& value) {
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+    if (p == end || *p < '0' || *p > '9') return nullptr;
+    long long v = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+        v = v * 10 + (*p++ - '0');
+        if (v > (long long)INT_MAX + 1) return nullptr;
+    }
+    if (negative) v = -v;
+    if (v > INT_MAX || v < INT_MIN) return nullptr;
+    value = (int)v;
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    return p;
+}
+
+// Parses one CSV line "pid,arrival,burst[,priority]" (priority defaults to 0)
+static bool parseProcessLine(const char* p, const char* end, WorkloadInput& workload) {
+    int fields[4] = {0, 0, 0, 0};
+    int count = 0;
+    while (true) {
+        if (count == 4) return false;
+        p = parseIntField(p, end, fields[count++]);
+        if (!p) return false;
+        if (p == end) break;
+        if (*p++ != ',') return false;
+    }
+    if (count < 3 || fields[1] < 0 || fields[2] < 0) return false;
+    workload.add(fields[0], fields[1], fields[2], fields[3]);
+    return true;
+}
+
+// Loads a process trace in CSV form ("-" reads standard input). The file is read in 1 MB
+// blocks and parsed in place, so the only allocations are the input columns themselves.
+// Blank lines and lines starting with '#' are skipped, as is a first line that does not
+// start with a number (a header).
+static bool loadWorkloadCSV(const string& path, WorkloadInput& workload, string& error) {
+    FILE* in = path == "-" ? stdin : fopen(path.c_str(), "rb");
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    // For a regular file, the size and the line length of the first block estimate the row count
+    long long fileSize = -1;
+    if (in != stdin && fseek(in, 0, SEEK_END) == 0) {
+        fileSize = ftell(in);
+        rewind(in);
+    }
+
+    const size_t BLOCK = 1 << 20;
+    vector<char> buffer(BLOCK);
+    size_t carried = 0; // Bytes of an incomplete line kept from the previous block
+    long long lineNumber = 0;
+    bool firstLine = true, ok = true, atEOF = false;
+    while (ok && !atEOF) {
+        if (carried == buffer.size()) buffer.resize(buffer.size() * 2); // Very long line
+        size_t got = fread(buffer.data() + carried, 1, buffer.size() - carried, in);
+        atEOF = got < buffer.size() - carried;
+        if (fileSize > 0 && lineNumber == 0) {
+            long long lines = count(buffer.data(), buffer.data() + got, '\n') + 1;
+            workload.reserve((int)min<long long>(fileSize * lines / max<size_t>(got, 1) + 16, INT_MAX / 2));
+        }
+        const char* p = buffer.data();
+        const char* end = p + carried + got;
+        while (ok) {
+            const char* nl = (const char*)memchr(p, '\n', end - p);
+            if (!nl && !atEOF) break;
+            const char* lineEnd = nl ? nl : end;
+            if (p == lineEnd && !nl) break; // Nothing after the last newline
+            lineNumber++;
+            const char* e = lineEnd;
+            if (e > p && e[-1] == '\r') e--;
+            const char* s = p;
+            while (s < e && (*s == ' ' || *s == '\t')) s++;
+            bool header = firstLine && s < e && !(*s >= '0' && *s <= '9') && *s != '-' && *s != '+';
+            if (s < e && *s != '#' && !header && !parseProcessLine(s, e, workload)) {
+                error = path + ":" + to_string(lineNumber) + ": expected pid,arrival,burst[,priority]";
+                ok = false;
+            }
+            if (s < e) firstLine = false;
+            p = nl ? nl + 1 : end;
+        }
+        carried = end - p;
+        memmove(buffer.data(), p, carried);
+    }
+    if (ok && ferror(in)) {
+        error = "error reading " + path;
+        ok = false;
+    }
+    if (in != stdin) fclose(in);
+    return ok;
+}
+
+// Binary workload trace. All integers are little-endian; the header is followed by the four
+// columns (pid, arrival, burst, priority), each starting at an 8-byte aligned offset.
+// Raw columns are packed int32 arrays that load with a single memcpy. With TRACE_VARINT the
+// pid and arrival columns store differences to the previous row and every value is
+// zigzag-encoded as a LEB128 varint, which takes 1-2 bytes per field for typical traces.
+const char TRACE_MAGIC[8] = {'C', 'P', 'U', 'T', 'R', 'A', 'C', 'E'};
+const uint32_t TRACE_VERSION = 1;
+const uint32_t TRACE_VARINT = 1;
+
+struct TraceHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t count;                // Number of processes
+    uint64_t columnOffset[4];      // pid, arrival, burst, priority
+    uint64_t columnBytes[4];
+};
+
+static inline bool hostIsLittleEndian() {
+    const uint32_t one = 1;
+    unsigned char first;
+    memcpy(&first, &one, 1);
+    return first == 1;
+}
+
+static inline uint64_t zigzagEncode(int64_t v) { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+static inline int64_t zigzagDecode(uint64_t v) { return (int64_t)(v >> 1) ^ -(int64_t)(v & 1); }
+
+static void appendVarint(vector<unsigned char>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back((unsigned char)(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back((unsigned char)v);
+}
+
+// Decodes `count` varints from [p, end) into `column`, adding each to the previous value
+// when `delta` is set. Fails on truncated or overlong input and on values outside int.
+static bool decodeVarintColumn(const unsigned char* p, const unsigned char* end, size_t count,
+                               bool delta, vector<int>& column) {
+    column.resize(count);
+    int64_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t v = 0;
+        int shift = 0;
+        while (true) {
+            if (p == end || shift > 35) return false;
+            unsigned char byte = *p++;
+            v |= (uint64_t)(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) break;
+            shift += 7;
+        }
+        int64_t value = zigzagDecode(v) + (delta ? previous : 0);
+        if (value < INT_MIN || value > INT_MAX) return false;
+        column[i] = (int)value;
+        previous = value;
+    }
+    return p == end;
+}
+
+// Read-only view of a whole file: mmap where available, otherwise read into memory
+class MappedFile {
+    private:
+        const unsigned char* bytes;
+        size_t length;
+        vector<unsigned char> copy; // Fallback storage
+#ifdef CPU_SCHEDULER_HAVE_MMAP
+        bool mapped;
+#endif
+
+    public:
+        MappedFile() : bytes(nullptr), length(0) {
+#ifdef CPU_SCHEDULER_HAVE_MMAP
+            mapped = false;
+#endif
+        }
+
+        ~MappedFile() {
+#ifdef CPU_SCHEDULER_HAVE_MMAP
+            if (mapped) munmap((void*)bytes, length);
+#endif
+        }
+
+        bool open(const string& path) {
+#ifdef CPU_SCHEDULER_HAVE_MMAP
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) return false;
+            struct stat info;
+            if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+                void* p = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    madvise(p, info.st_size, MADV_SEQUENTIAL);
+                    bytes = (const unsigned char*)p;
+                    length = info.st_size;
+                    mapped = true;
+                }
+            }
+            ::close(fd);
+            if (mapped) return true;
+#endif
+            FILE* in = fopen(path.c_str(), "rb");
+            if (!in) return false;
+            unsigned char block[1 << 16];
+            size_t got;
+            while ((got = fread(block, 1, sizeof(block), in)) > 0) copy.insert(copy.end(), block, block + got);
+            bool ok = !ferror(in);
+            fclose(in);
+            bytes = copy.data();
+            length = copy.size();
+            return ok;
+        }
+
+        const unsigned char* data() const { return bytes; }
+        size_t size() const { return length; }
+
+    private:
+        MappedFile(const MappedFile&);
+        MappedFile& operator=(const MappedFile&);
+};
+
+// True if the file at `path` starts with the binary trace magic
+static bool isBinaryTrace(const string& path) {
+    FILE* in = path == "-" ? nullptr : fopen(path.c_str(), "rb");
+    if (!in) return false;
+    char magic[sizeof(TRACE_MAGIC)];
+    bool match = fread(magic, 1, sizeof(magic), in) == sizeof(magic) && memcmp(magic, TRACE_MAGIC, sizeof(magic)) == 0;
+    fclose(in);
+    return match;
+}
+
+// Loads a binary trace. The file is mapped and each column goes straight into the matching
+// WorkloadInput column: one memcpy for raw columns, one decoding pass for varint ones.
+static bool loadWorkloadTrace(const string& path, WorkloadInput& workload, string& error) {
+    MappedFile file;
+    if (!file.open(path)) {
+        error = "cannot open " + path;
+        return false;
+    }
+    TraceHeader header;
+    if (file.size() < sizeof(header)) {
+        error = path + ": truncated trace header";
+        return false;
+    }
+    memcpy(&header, file.data(), sizeof(header));
+    if (memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0 || header.version != TRACE_VERSION) {
+        error = path + ": not a version " + to_string(TRACE_VERSION) + " trace";
+        return false;
+    }
+    if (!hostIsLittleEndian()) {
+        error = path + ": binary traces need a little-endian host";
+        return false;
+    }
+    if (header.count > (uint64_t)INT_MAX) {
+        error = path + ": too many processes";
+        return false;
+    }
+
+    size_t n = header.count;
+    bool varint = header.flags & TRACE_VARINT;
+    vector<int>* columns[4] = {&workload.pid, &workload.arrival, &workload.burst, &workload.priority};
+    for (int c = 0; c < 4; c++) {
+        uint64_t offset = header.columnOffset[c], bytes = header.columnBytes[c];
+        if (offset > file.size() || bytes > file.size() - offset || (!varint && bytes != n * sizeof(int32_t))) {
+            error = path + ": column " + to_string(c) + " is out of bounds";
+            return false;
+        }
+        const unsigned char* begin = file.data() + offset;
+        if (varint) {
+            if (!decodeVarintColumn(begin, begin + bytes, n, c < 2, *columns[c])) {
+                error = path + ": column " + to_string(c) + " is corrupt";
+                return false;
+            }
+        } else {
+            columns[c]->resize(n);
+            if (n) memcpy(columns[c]->data(), begin, bytes);
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (workload.arrival[i] < 0 || workload.burst[i] < 0) {
+            error = path + ": negative arrival or burst time for process " + to_string(i + 1);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Header for a trace whose columns follow it back to back, each 8-byte aligned
+static TraceHeader makeTraceHeader(uint64_t count, uint32_t flags, const uint64_t columnBytes[4]) {
+    TraceHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    header.version = TRACE_VERSION;
+    header.flags = flags;
+    header.count = count;
+    uint64_t offset = (sizeof(header) + 7) & ~7ULL;
+    for (int c = 0; c < 4; c++) {
+        header.columnOffset[c] = offset;
+        header.columnBytes[c] = columnBytes[c];
+        offset = (offset + columnBytes[c] + 7) & ~7ULL;
+    }
+    return header;
+}
+
+// Writes the input columns of a workload as a binary trace
+static bool saveWorkloadTrace(const string& path, const WorkloadInput& workload, bool varint, string& error) {
+    if (!hostIsLittleEndian()) {
+        error = "binary traces need a little-endian host";
+        return false;
+    }
+    size_t n = workload.size();
+    const vector<int>* columns[4] = {&workload.pid, &workload.arrival, &workload.burst, &workload.priority};
+    vector<unsigned char> encoded[4];
+    if (varint) {
+        for (int c = 0; c < 4; c++) {
+            encoded[c].reserve(n * 2);
+            int64_t previous = 0;
+            for (size_t i = 0; i < n; i++) {
+                int64_t value = (*columns[c])[i];
+                appendVarint(encoded[c], zigzagEncode(c < 2 ? value - previous : value));
+                previous = value;
+            }
+        }
+    }
+
+    uint64_t columnBytes[4];
+    for (int c = 0; c < 4; c++) columnBytes[c] = varint ? encoded[c].size() : n * sizeof(int32_t);
+    TraceHeader header = makeTraceHeader(n, varint ? TRACE_VARINT : 0, columnBytes);
+
+    FILE* out = fopen(path.c_str(), "wb");
+    if (!out) {
+        error = "cannot open " + path + " for writing";
+        return false;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, out) == 1;
+    uint64_t written = sizeof(header);
+    const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int c = 0; c < 4 && ok; c++) {
+        ok = fwrite(zeros, 1, header.columnOffset[c] - written, out) == header.columnOffset[c] - written;
+        const void* data = varint ? (const void*)encoded[c].data() : (const void*)columns[c]->data();
+        if (ok && header.columnBytes[c]) ok = fwrite(data, 1, header.columnBytes[c], out) == header.columnBytes[c];
+        written = header.columnOffset[c] + header.columnBytes[c];
+    }
+    ok = (fclose(out) == 0) && ok;
+    if (!ok) error = "error writing " + path;
+    return ok;
+}
+
+// Synthetic workloads. Every random number is a pure function of (seed, stream, row): a
+// counter-based generator that runs the SplitMix64 finalizer on the row index. Any block
+// of rows can then be produced on any thread, and the output does not depend on the
+// thread count. Arrival times are prefix sums of inter-arrival gaps and are computed in two
+// passes over fixed blocks, as in FCFSParallel. The first pass finds each block's sum and
+// the MMPP state the block leaves behind. The second regenerates each block from its known
+// start.
+enum ArrivalProcess {
+    ARRIVALS_POISSON, // Exponential gaps at `rate`
+    ARRIVALS_MMPP,    // Two-state Markov-modulated Poisson: calm at `rate`, bursty at `peakRate`
+    ARRIVALS_DIURNAL  // Poisson with rate * (1 + amplitude * sin(2 pi t / period))
+};
+
+enum BurstDistribution { BURSTS_EXPONENTIAL, BURSTS_LOGNORMAL, BURSTS_PARETO, BURSTS_BIMODAL };
+
+struct GeneratorConfig {
+    long long count = 1000;
+    uint64_t seed = 1;
+    ArrivalProcess arrivals = ARRIVALS_POISSON;
+    double rate = 0.08;        // Arrivals per time unit
+    double peakRate = 0.8;     // MMPP: rate in the bursty state
+    double enterBurst = 0.01;  // MMPP: chance per arrival of switching from calm to bursty
+    double leaveBurst = 0.1;   // MMPP: chance per arrival of switching back
+    double amplitude = 0.8;    // Diurnal: relative rate swing, 0..1
+    double period = 86400;     // Diurnal: period in time units
+    BurstDistribution bursts = BURSTS_EXPONENTIAL;
+    double meanBurst = 10;     // Mean burst time (bimodal: of the short jobs)
+    double sigma = 1;          // Lognormal: standard deviation of log(burst)
+    double alpha = 1.5;        // Pareto: tail index, > 1
+    double longBurst = 100;    // Bimodal: mean burst time of the long jobs
+    double longFraction = 0.1; // Bimodal: share of long jobs
+    int maxBurst = 1000000;    // Burst times are clamped to [1, maxBurst]
+    vector<double> priorityWeights = vector<double>(10, 1.0); // Relative weights of priorities 1, 2, ...
+};
+
+class WorkloadGenerator {
+    public:
+        static const int BLOCK = 1 << 16; // Rows per block
+
+    private:
+        enum { STREAM_GAP, STREAM_SWITCH, STREAM_BURST, STREAM_SHAPE, STREAM_PRIORITY, STREAMS };
+
+        GeneratorConfig config;
+        uint64_t streamKey[STREAMS];
+        vector<double> priorityCDF;
+        vector<double> blockStart;        // Arrival clock at the start of each block
+        vector<unsigned char> blockState; // MMPP state at the start of each block
+
+        static uint64_t splitMix(uint64_t z) {
+            z += 0x9e3779b97f4a7c15ULL;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        // Uniform in (0, 1), never exactly 0 or 1
+        double uniform(int stream, uint64_t row) const {
+            uint64_t bits = splitMix(streamKey[stream] + row * 0x9e3779b97f4a7c15ULL);
+            return ((bits >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+        }
+
+        // Runs the arrival clock over block b from 0 in MMPP state `state`, calling
+        // visit(offset, clock) for each row. Returns the clock at the end of the block and
+        // leaves the state the block ends in. For diurnal arrivals the clock runs in
+        // rescaled time (see arrivalTime).
+        template <class Visit>
+        double scanBlock(long long b, int& state, Visit visit) const {
+            long long first = b * BLOCK, last = min(config.count, first + BLOCK);
+            double clock = 0;
+            for (long long i = first; i < last; i++) {
+                clock += -log(uniform(STREAM_GAP, i)) / (state ? config.peakRate : config.rate);
+                visit(i - first, clock);
+                if (config.arrivals == ARRIVALS_MMPP &&
+                    uniform(STREAM_SWITCH, i) < (state ? config.leaveBurst : config.enterBurst)) {
+                    state ^= 1;
+                }
+            }
+            return clock;
+        }
+
+        // Maps the arrival clock to time. Diurnal arrivals are a unit-rate Poisson process in
+        // the integrated rate L(t) = t + amplitude * period / 2pi * (1 - cos(2pi t / period)),
+        // so t is found by inverting L with Newton steps. L' >= 1 - amplitude keeps this safe.
+        double arrivalTime(double clock) const {
+            if (config.arrivals != ARRIVALS_DIURNAL) return clock;
+            double w = 2 * M_PI / config.period, a = config.amplitude;
+            double low = max(0.0, clock - 2 * a / w), high = clock, t = clock - a / w;
+            for (int step = 0; step < 50; step++) {
+                double f = t + a / w * (1 - cos(w * t)) - clock;
+                if (f > 0) high = t;
+                else low = t;
+                double next = t - f / (1 + a * sin(w * t));
+                if (!(next > low && next < high)) next = (low + high) / 2;
+                if (fabs(next - t) < 1e-9 * max(1.0, t)) break;
+                t = next;
+            }
+            return t;
+        }
+
+        int burstTime(uint64_t i) const {
+            double u = uniform(STREAM_BURST, i), x = 0;
+            switch (config.bursts) {
+                case BURSTS_EXPONENTIAL:
+                    x = -log(u) * config.meanBurst;
+                    break;
+                case BURSTS_LOGNORMAL: {
+                    double mu = log(config.meanBurst) - config.sigma * config.sigma / 2;
+                    double normal = sqrt(-2 * log(u)) * cos(2 * M_PI * uniform(STREAM_SHAPE, i));
+                    x = exp(mu + config.sigma * normal);
+                    break;
+                }
+                case BURSTS_PARETO: {
+                    double scale = config.meanBurst * (config.alpha - 1) / config.alpha;
+                    x = scale / pow(u, 1 / config.alpha);
+                    break;
+                }
+                case BURSTS_BIMODAL:
+                    x = -log(u) * (uniform(STREAM_SHAPE, i) < config.longFraction ? config.longBurst : config.meanBurst);
+                    break;
+            }
+            return (int)min((double)config.maxBurst, max(1.0, floor(x + 0.5)));
+        }
+
+        int priority(uint64_t i) const {
+            double u = uniform(STREAM_PRIORITY, i) * priorityCDF.back();
+            return int(upper_bound(priorityCDF.begin(), priorityCDF.end() - 1, u) - priorityCDF.begin()) + 1;
+        }
+
+    public:
+        explicit WorkloadGenerator(const GeneratorConfig& config) : config(config) {
+            for (int s = 0; s < STREAMS; s++) streamKey[s] = splitMix(config.seed * STREAMS + s);
+            double total = 0;
+            for (double w : config.priorityWeights) priorityCDF.push_back(total += w);
+        }
+
+        long long blocks() const { return (config.count + BLOCK - 1) / BLOCK; }
+
+        // First pass: the arrival clock and MMPP state at the start of every block. Fails if
+        // the last arrival does not fit in an int.
+        bool prepare(int threads, string& error) {
+            long long n = blocks();
+            // Sum and end state of each block for both start states (only MMPP needs state 1)
+            vector<double> sum[2] = {vector<double>(n), vector<double>(n)};
+            vector<unsigned char> endState[2] = {vector<unsigned char>(n), vector<unsigned char>(n)};
+            int states = config.arrivals == ARRIVALS_MMPP ? 2 : 1;
+            atomic<long long> nextBlock(0);
+            runOnThreads(min<long long>(threads, max(n, 1LL)), [&](int) {
+                for (long long b = nextBlock++; b < n; b = nextBlock++) {
+                    for (int s = 0; s < states; s++) {
+                        int state = s;
+                        sum[s][b] = scanBlock(b, state, [](long long, double) {});
+                        endState[s][b] = state;
+                    }
+                }
+            });
+
+            blockStart.assign(n + 1, 0);
+            blockState.assign(n + 1, 0);
+            for (long long b = 0; b < n; b++) {
+                int s = blockState[b];
+                blockStart[b + 1] = blockStart[b] + sum[s][b];
+                blockState[b + 1] = endState[s][b];
+            }
+            if (floor(arrivalTime(blockStart[n])) > INT_MAX) {
+                error = "arrival times overflow int: lower n or raise rate";
+                return false;
+            }
+            return true;
+        }
+
+        // Second pass, per column: rows of block b (after prepare)
+        void pidBlock(long long b, int* out) const {
+            long long first = b * BLOCK, last = min(config.count, first + BLOCK);
+            for (long long i = first; i < last; i++) out[i - first] = (int)(i + 1);
+        }
+
+        void arrivalBlock(long long b, int* out) const {
+            int state = blockState[b];
+            double start = blockStart[b];
+            scanBlock(b, state, [&](long long offset, double clock) {
+                out[offset] = (int)floor(arrivalTime(start + clock));
+            });
+        }
+
+        void burstBlock(long long b, int* out) const {
+            long long first = b * BLOCK, last = min(config.count, first + BLOCK);
+            for (long long i = first; i < last; i++) out[i - first] = burstTime(i);
+        }
+
+        void priorityBlock(long long b, int* out) const {
+            long long first = b * BLOCK, last = min(config.count, first + BLOCK);
+            for (long long i = first; i < last; i++) out[i - first] = priority(i);
+        }
+
+        // Generates the whole workload in memory; `threads` = 0 uses every hardware thread
+        bool generate(WorkloadInput& workload, int threads, string& error) {
+            if (config.count > INT_MAX) {
+                error = "a workload holds at most " + to_string(INT_MAX) + " processes";
+                return false;
+            }
+            if (threads <= 0) threads = defaultThreadCount();
+            if (!prepare(threads, error)) return false;
+            size_t n = config.count;
+            workload.pid.resize(n);
+            workload.arrival.resize(n);
+            workload.burst.resize(n);
+            workload.priority.resize(n);
+            long long count = blocks();
+            atomic<long long> nextBlock(0);
+            runOnThreads(min<long long>(threads, max(count, 1LL)), [&](int) {
+                for (long long b = nextBlock++; b < count; b = nextBlock++) {
+                    size_t first = b * BLOCK;
+                    pidBlock(b, &workload.pid[first]);
+                    arrivalBlock(b, &workload.arrival[first]);
+                    burstBlock(b, &workload.burst[first]);
+                    priorityBlock(b, &workload.priority[first]);
+                }
+            });
+            return true;
+        }
+
+        // Streams the workload into a raw binary trace, one column at a time, without holding
+        // more than a few blocks per thread in memory; `threads` = 0 uses every hardware thread
+        bool writeTrace(const string& path, int threads, string& error) {
+            if (!hostIsLittleEndian()) {
+                error = "binary traces need a little-endian host";
+                return false;
+            }
+            if (config.count > INT_MAX) {
+                error = "a trace holds at most " + to_string(INT_MAX) + " processes";
+                return false;
+            }
+            if (threads <= 0) threads = defaultThreadCount();
+            if (!prepare(threads, error)) return false;
+
+            uint64_t columnBytes[4];
+            for (int c = 0; c < 4; c++) columnBytes[c] = config.count * sizeof(int32_t);
+            TraceHeader header = makeTraceHeader(config.count, 0, columnBytes);
+            FILE* out = fopen(path.c_str(), "wb");
+            if (!out) {
+                error = "cannot open " + path + " for writing";
+                return false;
+            }
+            bool ok = fwrite(&header, sizeof(header), 1, out) == 1;
+            uint64_t written = sizeof(header);
+            const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+            // Each round fills a run of blocks in parallel and writes them in order
+            long long count = blocks(), perRound = 4LL * threads;
+            vector<int> buffer(min(count, perRound) * BLOCK);
+            for (int c = 0; c < 4 && ok; c++) {
+                ok = fwrite(zeros, 1, header.columnOffset[c] - written, out) == header.columnOffset[c] - written;
+                for (long long round = 0; round < count && ok; round += perRound) {
+                    long long end = min(count, round + perRound);
+                    atomic<long long> nextBlock(round);
+                    runOnThreads(min<long long>(threads, end - round), [&](int) {
+                        for (long long b = nextBlock++; b < end; b = nextBlock++) {
+                            int* block = &buffer[(b - round) * BLOCK];
+                            if (c == 0) pidBlock(b, block);
+                            else if (c == 1) arrivalBlock(b, block);
+                            else if (c == 2) burstBlock(b, block);
+                            else priorityBlock(b, block);
+                        }
+                    });
+                    size_t rows = min(config.count, end * BLOCK) - round * BLOCK;
+                    ok = fwrite(buffer.data(), sizeof(int32_t), rows, out) == rows;
+                }
+                written = header.columnOffset[c] + header.columnBytes[c];
+            }
+            ok = (fclose(out) == 0) && ok;
+            if (!ok) error = "error writing " + path;
+            return ok;
+        }
+};
+
+// Per-process results of one algorithm, appended to the results CSV
+static void writeResultsCSV(BufferedWriter& out, const string& algorithm, const Workload& workload) {
+    for (int i = 0; i < workload.size(); i++) {
+        out.text(algorithm);
+        const int columns[] = {workload.pid[i], workload.arrival[i], workload.burst[i], workload.priority[i],
+                               workload.completion[i], workload.turnaroundTime(i), workload.waitingTime(i),
+                               workload.responseTime(i), workload.preemptions[i], workload.contextSwitches[i]};
+        for (int v : columns) {
+            out.character(',');
+            out.integer(v);
+        }
+        out.character('\n');
+    }
+}
+
+// One workload of a batch run
+struct WorkloadSource {
+    string path;           // Input file, or the spec for a generated workload
+    bool generate = false; // Synthetic workload (--generate)
+    GeneratorConfig generator;
+};
+
+// Options of one batch run with their defaults
+struct BatchOptions {
+    vector<string> algorithms;
+    vector<WorkloadSource> workloads; // --input / --generate; one each, or any number with --sweep
+    string outputPath;
+    string segmentsPath; // Execution segments CSV (--segments)
+    string tracePath;   // Binary trace to write (--write-trace)
+    string chromeTracePath; // Chrome JSON trace of the segments (--chrome-trace)
+    string perfettoPath;    // Perfetto protobuf trace of the segments (--perfetto)
+    bool varint = false; // Delta+varint encoding for --write-trace
+    bool coalesce = false; // Merge back-to-back segments of a process before writing them
+    bool help = false;
+    int quantum = 4;
+    int agingInterval = 5;
+    vector<int> quanta;         // Every --quantum value (several only with --sweep)
+    vector<int> agingIntervals; // Every --aging value (several only with --sweep)
+    bool sweep = false;         // Evaluate the whole parameter grid (--sweep)
+    int threads = 0;            // Sweep workers, 0 = every hardware thread
+    int scanThreads = 0;        // Threads of the parallel FCFS scan, 0 = every hardware thread
+    vector<int> mlfqQuanta; // Defaults to quantum, 2*quantum, 4*quantum
+    int boostPeriod = 0;
+    int targetLatency = 24;
+    int minGranularity = 3;
+    int baseSlice = 3;
+};
+
+static const char* BATCH_ALGORITHMS[] = {
+    "fcfs", "sjf", "rr", "priority", "priority-aging", "srtf", "priority-preemptive", "mlfq", "cfs", "eevdf"
+};
+
+static void printBatchUsage(ostream& out) {
+    out << "Usage: cpuScheduler --algo NAME[,NAME...] --input FILE [--output FILE] [options]\n"
+        << "  --algo         one or more of:";
+    for (const char* name : BATCH_ALGORITHMS) out << ' ' << name;
+    out << "\n"
+        << "  --input        CSV trace, one process per line: pid,arrival,burst[,priority] (- = stdin),\n"
+        << "                 or a binary trace written by --write-trace\n"
+        << "  --generate SPEC  synthetic workload instead of --input; SPEC is key=value,... with keys\n"
+        << "                 n, seed, arrivals=poisson|mmpp|diurnal, rate, peak, enter, leave, amplitude,\n"
+        << "                 period, bursts=exponential|lognormal|pareto|bimodal, mean, sigma, alpha,\n"
+        << "                 long, mix, max-burst, priorities=W/W/... (weights of priorities 1, 2, ...)\n"
+        << "  --write-trace FILE  save the input as a binary trace (add --varint to compress it);\n"
+        << "                 a generated workload is streamed to it when there is no --algo or --varint\n"
+        << "  --output       per-process results CSV (- = stdout)\n"
+        << "  --segments     execution segments CSV, streamed while the engines run (- = stdout)\n"
+        << "  --coalesce     merge back-to-back segments of the same process\n"
+        << "  --chrome-trace FILE  Chrome JSON trace (chrome://tracing, ui.perfetto.dev), one run per algorithm\n"
+        << "  --perfetto FILE      Perfetto protobuf trace of the same tracks and ready-queue counters\n"
+        << "  --quantum N    Round Robin time quantum (default 4)\n"
+        << "  --aging N      priority aging interval (default 5)\n"
+        << "  --sweep        evaluate every workload x algorithm x quantum x aging interval in parallel;\n"
+        << "                 --input/--generate may repeat and --quantum/--aging take lists (2,4,8),\n"
+        << "                 one results row per point goes to --output (default stdout)\n"
+        << "  --threads N    sweep worker threads (default: all hardware threads)\n"
+        << "  --mlfq Q,Q,..  MLFQ per-level quanta (default quantum, 2x, 4x)\n"
+        << "  --boost N      MLFQ priority boost period (default 0 = none)\n"
+        << "  --latency N    CFS target latency (default 24)\n"
+        << "  --granularity N  CFS minimum granularity (default 3)\n"
+        << "  --slice N      EEVDF base slice (default 3)\n"
+        << "A summary line per algorithm is printed to standard output.\n"
+        << "Exit status: 0 ok, 2 bad arguments, 3 bad input, 4 output error.\n";
+}
+
+// Parses a whole option value as an int no smaller than `minimum`
+static bool parseIntOption(const string& text, int minimum, int& value) {
+    const char* end = text.c_str() + text.size();
+    int parsed;
+    const char* p = parseIntField(text.c_str(), end, parsed);
+    if (p != end || parsed < minimum) return false;
+    value = parsed;
+    return true;
+}
+
+static void splitList(const string& text, vector<string>& items) {
+    size_t start = 0;
+    while (start <= text.size()) {
+        size_t comma = text.find(',', start);
+        if (comma == string::npos) comma = text.size();
+        if (comma > start) items.push_back(text.substr(start, comma - start));
+        start = comma + 1;
+    }
+}
+
+// Parses a comma-separated list of ints no smaller than `minimum`
+static bool parseIntList(const string& text, int minimum, vector<int>& values) {
+    vector<string> items;
+    splitList(text, items);
+    values.clear();
+    for (const auto& item : items) {
+        int v;
+        if (!parseIntOption(item, minimum, v)) return false;
+        values.push_back(v);
+    }
+    return !values.empty();
+}
+
+// Parses a whole option value as a double
+static bool parseDoubleOption(const string& text, double& value) {
+    char* end;
+    errno = 0;
+    double parsed = strtod(text.c_str(), &end);
+    if (text.empty() || *end != '\0' || errno == ERANGE || !std::isfinite(parsed)) return false;
+    value = parsed;
+    return true;
+}
+
+// Parses a generator spec: comma-separated key=value pairs, e.g.
+// "n=1e6,arrivals=mmpp,bursts=pareto,alpha=1.2,priorities=5/3/1,seed=7"
+static bool parseGeneratorSpec(const string& spec, GeneratorConfig& config, string& error) {
+    vector<string> items;
+    splitList(spec, items);
+    for (const auto& item : items) {
+        size_t eq = item.find('=');
+        string key = item.substr(0, eq), value = eq == string::npos ? "" : item.substr(eq + 1);
+        double number = 0;
+        bool numeric = parseDoubleOption(value, number);
+        bool ok = true;
+        if (key == "arrivals") {
+            if (value == "poisson") config.arrivals = ARRIVALS_POISSON;
+            else if (value == "mmpp") config.arrivals = ARRIVALS_MMPP;
+            else if (value == "diurnal") config.arrivals = ARRIVALS_DIURNAL;
+            else ok = false;
+        } else if (key == "bursts") {
+            if (value == "exponential") config.bursts = BURSTS_EXPONENTIAL;
+            else if (value == "lognormal") config.bursts = BURSTS_LOGNORMAL;
+            else if (value == "pareto") config.bursts = BURSTS_PARETO;
+            else if (value == "bimodal") config.bursts = BURSTS_BIMODAL;
+            else ok = false;
+        } else if (key == "priorities") {
+            vector<double> weights;
+            double total = 0;
+            size_t start = 0;
+            while (ok && start <= value.size()) {
+                size_t slash = value.find('/', start);
+                if (slash == string::npos) slash = value.size();
+                double w;
+                ok = parseDoubleOption(value.substr(start, slash - start), w) && w >= 0;
+                weights.push_back(w);
+                total += w;
+                start = slash + 1;
+            }
+            ok = ok && total > 0;
+            if (ok) config.priorityWeights = weights;
+        } else if (!numeric) {
+            ok = false;
+        } else if (key == "n") {
+            ok = number >= 0 && number <= INT_MAX && number == floor(number);
+            config.count = (long long)number;
+        } else if (key == "seed") {
+            ok = number >= 0 && number == floor(number) && number < 18446744073709551616.0;
+            config.seed = (uint64_t)number;
+        } else if (key == "rate") {
+            ok = number > 0;
+            config.rate = number;
+        } else if (key == "peak") {
+            ok = number > 0;
+            config.peakRate = number;
+        } else if (key == "enter" || key == "leave" || key == "amplitude" || key == "mix") {
+            ok = number >= 0 && number <= 1;
+            if (key == "enter") config.enterBurst = number;
+            else if (key == "leave") config.leaveBurst = number;
+            else if (key == "amplitude") config.amplitude = number;
+            else config.longFraction = number;
+        } else if (key == "period") {
+            ok = number > 0;
+            config.period = number;
+        } else if (key == "mean") {
+            ok = number > 0;
+            config.meanBurst = number;
+        } else if (key == "sigma") {
+            ok = number >= 0;
+            config.sigma = number;
+        } else if (key == "alpha") {
+            ok = number > 1;
+            config.alpha = number;
+        } else if (key == "long") {
+            ok = number > 0;
+            config.longBurst = number;
+        } else if (key == "max-burst") {
+            ok = number >= 1 && number <= INT_MAX && number == floor(number);
+            config.maxBurst = (int)number;
+        } else {
+            error = "unknown generator key: " + key;
+            return false;
+        }
+        if (!ok) {
+            error = "invalid generator value: " + item;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns false (after printing why) on a malformed command line
+static bool parseBatchOptions(int argc, char* argv[], BatchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i], value;
+        size_t eq = arg.find('=');
+        if (arg.compare(0, 2, "--") == 0 && eq != string::npos) {
+            value = arg.substr(eq + 1);
+            arg = arg.substr(0, eq);
+        } else if (arg != "--help" && arg != "-h" && arg != "--varint" && arg != "--coalesce" && arg != "--sweep") {
+            if (i + 1 >= argc) {
+                cerr << "Missing value for " << arg << endl;
+                return false;
+            }
+            value = argv[++i];
+        }
+
+        bool ok = true;
+        if (arg == "--help" || arg == "-h") {
+            options.help = true;
+            return true;
+        } else if (arg == "--algo") {
+            vector<string> names;
+            splitList(value, names);
+            for (const auto& name : names) {
+                if (find(begin(BATCH_ALGORITHMS), end(BATCH_ALGORITHMS), name) == end(BATCH_ALGORITHMS)) {
+                    cerr << "Unknown algorithm: " << name << endl;
+                    return false;
+                }
+                options.algorithms.push_back(name);
+            }
+        } else if (arg == "--varint") {
+            options.varint = true;
+        } else if (arg == "--coalesce") {
+            options.coalesce = true;
+        } else if (arg == "--sweep") {
+            options.sweep = true;
+        } else if (arg == "--write-trace") {
+            options.tracePath = value;
+        } else if (arg == "--input") {
+            WorkloadSource source;
+            source.path = value;
+            options.workloads.push_back(source);
+        } else if (arg == "--generate") {
+            WorkloadSource source;
+            source.path = value;
+            source.generate = true;
+            string error;
+            if (!parseGeneratorSpec(value, source.generator, error)) {
+                cerr << error << endl;
+                return false;
+            }
+            options.workloads.push_back(source);
+        } else if (arg == "--output") {
+            options.outputPath = value;
+        } else if (arg == "--segments") {
+            options.segmentsPath = value;
+        } else if (arg == "--chrome-trace") {
+            options.chromeTracePath = value;
+        } else if (arg == "--perfetto") {
+            options.perfettoPath = value;
+        } else if (arg == "--quantum") {
+            ok = parseIntList(value, 1, options.quanta);
+        } else if (arg == "--aging") {
+            ok = parseIntList(value, 1, options.agingIntervals);
+        } else if (arg == "--threads") {
+            ok = parseIntOption(value, 1, options.threads);
+        } else if (arg == "--mlfq") {
+            vector<string> items;
+            splitList(value, items);
+            options.mlfqQuanta.clear();
+            for (const auto& item : items) {
+                int q;
+                ok = ok && parseIntOption(item, 1, q);
+                options.mlfqQuanta.push_back(q);
+            }
+            ok = ok && !items.empty() && items.size() <= 64;
+        } else if (arg == "--boost") {
+            ok = parseIntOption(value, 0, options.boostPeriod);
+        } else if (arg == "--latency") {
+            ok = parseIntOption(value, 1, options.targetLatency);
+        } else if (arg == "--granularity") {
+            ok = parseIntOption(value, 1, options.minGranularity);
+        } else if (arg == "--slice") {
+            ok = parseIntOption(value, 1, options.baseSlice);
+        } else {
+            cerr << "Unknown option: " << arg << endl;
+            return false;
+        }
+        if (!ok) {
+            cerr << "Invalid value for " << arg << ": " << value << endl;
+            return false;
+        }
+    }
+    if (options.sweep) {
+        if (options.workloads.empty() || options.algorithms.empty()) {
+            cerr << "--sweep needs --algo and at least one --input or --generate" << endl;
+            return false;
+        }
+        if (!options.segmentsPath.empty() || !options.tracePath.empty() || !options.chromeTracePath.empty() ||
+            !options.perfettoPath.empty()) {
+            cerr << "--sweep only writes the results table (--output)" << endl;
+            return false;
+        }
+    } else {
+        if (options.workloads.size() != 1 || (options.algorithms.empty() && options.tracePath.empty())) {
+            cerr << "one of --input or --generate and at least one of --algo or --write-trace are required" << endl;
+            return false;
+        }
+        if (options.quanta.size() > 1 || options.agingIntervals.size() > 1) {
+            cerr << "lists of --quantum or --aging values need --sweep" << endl;
+            return false;
+        }
+    }
+    if (options.quanta.empty()) options.quanta.push_back(options.quantum);
+    if (options.agingIntervals.empty()) options.agingIntervals.push_back(options.agingInterval);
+    options.quantum = options.quanta[0];
+    options.agingInterval = options.agingIntervals[0];
+    return true;
+}
+
+// Runs one algorithm by batch name on the workload (the engines reset the per-run columns)
+template <class Sink>
+static void runBatchAlgorithm(const string& name, Workload& workload, Sink& sink, const BatchOptions& options) {
+    if (name == "fcfs") Scheduler::FCFSParallel(workload, sink, options.scanThreads);
+    else if (name == "sjf") Scheduler::SJFEventDriven(workload, sink);
+    else if (name == "rr") Scheduler::RoundRobinEventDriven(workload, sink, options.quantum);
+    else if (name == "priority") Scheduler::PriorityEventDriven(workload, sink, false);
+    else if (name == "priority-aging") Scheduler::PriorityEventDriven(workload, sink, true, options.agingInterval);
+    else if (name == "srtf") Scheduler::SRTF(workload, sink);
+    else if (name == "priority-preemptive") Scheduler::PriorityPreemptive(workload, sink, true, options.agingInterval);
+    else if (name == "mlfq") {
+        int q = options.quantum;
+        vector<int> defaultQuanta = {q, 2 * q, 4 * q};
+        Scheduler::MLFQ(workload, sink, options.mlfqQuanta.empty() ? defaultQuanta : options.mlfqQuanta,
+                        options.boostPeriod);
+    }
+    else if (name == "cfs") Scheduler::CFS(workload, sink, options.targetLatency, options.minGranularity);
+    else if (name == "eevdf") Scheduler::EEVDF(workload, sink, options.baseSlice);
+}
+
+// Fans the segments of a batch run out to every requested segment output
+struct BatchSegmentOutputs {
+    FileSink* file = nullptr;
+    ChromeTraceWriter* chrome = nullptr;
+    PerfettoTraceWriter* perfetto = nullptr;
+    BusyPeriods* busy = nullptr; // For the trace counters
+
+    void push(const ExecutionSegment& segment) {
+        if (file) file->push(segment);
+        if (chrome) chrome->push(segment);
+        if (perfetto) perfetto->push(segment);
+        if (busy) busy->push(segment);
+    }
+};
+
+// Opens an output file ("-" = standard output); prints why on failure
+static FILE* openOutputFile(const string& path) {
+    FILE* out = path == "-" ? stdout : fopen(path.c_str(), "wb");
+    if (!out) cerr << "cannot open " << path << " for writing" << endl;
+    return out;
+}
+
+// Flushes and closes an output file; false if anything failed to write
+static bool closeOutputFile(FILE* out, BufferedWriter& writer) {
+    writer.flush();
+    bool written = writer.good();
+    if (out != stdout) return (fclose(out) == 0) && written;
+    return (fflush(out) == 0) && written;
+}
+
+// Loads an input file or generates a workload
+static bool loadWorkloadSource(const WorkloadSource& source, WorkloadInput& workload, string& error) {
+    if (source.generate) return WorkloadGenerator(source.generator).generate(workload, 0, error);
+    return isBinaryTrace(source.path) ? loadWorkloadTrace(source.path, workload, error)
+                                      : loadWorkloadCSV(source.path, workload, error);
+}
+
+// Whether an algorithm reads the quantum / the aging interval (other points of the grid
+// would only repeat the same run)
+static bool usesQuantum(const string& name, const BatchOptions& options) {
+    return name == "rr" || (name == "mlfq" && options.mlfqQuanta.empty());
+}
+
+static bool usesAgingInterval(const string& name) {
+    return name == "priority-aging" || name == "priority-preemptive";
+}
+
+// One point of a parameter sweep; -1 marks a parameter the algorithm does not use
+struct SweepPoint {
+    int workload;
+    const string* algorithm;
+    int quantum;
+    int agingInterval;
+};
+
+// Sweep mode: runs every workload x algorithm x quantum x aging interval point on a
+// work-stealing pool and writes one CSV row per point, in grid order. The loaded input
+// columns are shared read-only by every worker; each point only allocates the per-run
+// columns of its Workload.
+static int runSweep(const BatchOptions& options) {
+    vector<WorkloadInput> workloads(options.workloads.size());
+    for (size_t k = 0; k < workloads.size(); k++) {
+        string error;
+        if (!loadWorkloadSource(options.workloads[k], workloads[k], error)) {
+            cerr << error << endl;
+            return EXIT_BATCH_INPUT;
+        }
+    }
+
+    // Workload-major order, so the contiguous range each worker starts with mostly shares one
+    vector<SweepPoint> points;
+    for (size_t k = 0; k < workloads.size(); k++) {
+        for (const auto& name : options.algorithms) {
+            vector<int> quanta = usesQuantum(name, options) ? options.quanta : vector<int>(1, -1);
+            vector<int> agingIntervals = usesAgingInterval(name) ? options.agingIntervals : vector<int>(1, -1);
+            for (int q : quanta) {
+                for (int a : agingIntervals) points.push_back({(int)k, &name, q, a});
+            }
+        }
+    }
+
+    int threads = options.threads > 0 ? options.threads : defaultThreadCount();
+    vector<string> rows(points.size());
+    auto sweepStart = chrono::steady_clock::now();
+    runWorkStealing(points.size(), threads, [&](int, int task) {
+        const SweepPoint& point = points[task];
+        Workload workload(workloads[point.workload]);
+        BatchOptions pointOptions = options;
+        if (point.quantum > 0) pointOptions.quantum = point.quantum;
+        if (point.agingInterval > 0) pointOptions.agingInterval = point.agingInterval;
+        pointOptions.scanThreads = 1; // The pool already keeps every hardware thread busy
+
+        auto start = chrono::steady_clock::now();
+        CountingSink sink;
+        CompletionMetrics metrics;
+        workload.metrics = &metrics;
+        runBatchAlgorithm(*point.algorithm, workload, sink, pointOptions);
+        workload.metrics = nullptr;
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        ostringstream row;
+        row << ',' << *point.algorithm << ',';
+        if (point.quantum > 0) row << point.quantum;
+        row << ',';
+        if (point.agingInterval > 0) row << point.agingInterval;
+        row << ',' << workload.size() << ',' << metrics.makespan << ',' << fixed << setprecision(4)
+            << metrics.throughput() << ',' << metrics.turnaround.mean() << ',' << metrics.waiting.mean() << ','
+            << metrics.response.mean() << ',' << metrics.turnaround.percentile(99) << ','
+            << metrics.waiting.percentile(99) << ',' << metrics.response.percentile(99)
+            << ',' << sink.segments << ',' << setprecision(6) << seconds << '\n';
+        rows[task] = row.str();
+    });
+    double elapsed = chrono::duration<double>(chrono::steady_clock::now() - sweepStart).count();
+
+    FILE* out = options.outputPath.empty() ? stdout : openOutputFile(options.outputPath);
+    if (!out) return EXIT_BATCH_OUTPUT;
+    BufferedWriter writer(out);
+    writer.text("workload,algorithm,quantum,aging_interval,processes,makespan,throughput,avg_turnaround,"
+                "avg_waiting,avg_response,p99_turnaround,p99_waiting,p99_response,segments,seconds\n");
+    for (size_t i = 0; i < points.size(); i++) {
+        // Paths and generator specs may contain commas or quotes
+        const string& name = options.workloads[points[i].workload].path;
+        if (name.find_first_of(",\"") == string::npos) {
+            writer.text(name);
+        } else {
+            writer.character('"');
+            for (char c : name) {
+                if (c == '"') writer.character('"');
+                writer.character(c);
+            }
+            writer.character('"');
+        }
+        writer.text(rows[i]);
+    }
+    if (!closeOutputFile(out, writer)) {
+        cerr << "error writing " << (options.outputPath.empty() ? "standard output" : options.outputPath) << endl;
+        return EXIT_BATCH_OUTPUT;
+    }
+    cerr << "swept " << points.size() << " points on " << min<size_t>(threads, max<size_t>(points.size(), 1))
+         << " threads in " << fixed << setprecision(3) << elapsed << " s" << endl;
+    return EXIT_BATCH_OK;
+}
+
+// Non-interactive entry point; returns the process exit status
+int runBatch(int argc, char* argv[]) {
+    BatchOptions options;
+    if (!parseBatchOptions(argc, argv, options)) {
+        printBatchUsage(cerr);
+        return EXIT_BATCH_USAGE;
+    }
+    if (options.help) {
+        printBatchUsage(cout);
+        return EXIT_BATCH_OK;
+    }
+    if (options.sweep) return runSweep(options);
+
+    WorkloadInput input;
+    string error;
+    const WorkloadSource& source = options.workloads[0];
+    if (source.generate && options.algorithms.empty() && !options.varint) {
+        // Nothing needs the rows in memory
+        WorkloadGenerator generator(source.generator);
+        if (!generator.writeTrace(options.tracePath, 0, error)) {
+            cerr << error << endl;
+            return EXIT_BATCH_OUTPUT;
+        }
+        return EXIT_BATCH_OK;
+    }
+    if (!loadWorkloadSource(source, input, error)) {
+        cerr << error << endl;
+        return EXIT_BATCH_INPUT;
+    }
+    if (!options.tracePath.empty() && !saveWorkloadTrace(options.tracePath, input, options.varint, error)) {
+        cerr << error << endl;
+        return EXIT_BATCH_OUTPUT;
+    }
+    if (options.algorithms.empty()) return EXIT_BATCH_OK;
+    Workload workload(input);
+
+    FILE* out = nullptr;
+    FILE* segmentsOut = nullptr;
+    if (!options.outputPath.empty() && !(out = openOutputFile(options.outputPath))) return EXIT_BATCH_OUTPUT;
+    if (!options.segmentsPath.empty() && !(segmentsOut = openOutputFile(options.segmentsPath))) {
+        return EXIT_BATCH_OUTPUT;
+    }
+    BufferedWriter writer(out ? out : stdout);
+    BufferedWriter segmentWriter(segmentsOut ? segmentsOut : stdout);
+    if (out) {
+        writer.text("algorithm,pid,arrival,burst,priority,completion,turnaround,waiting,response,"
+                    "preemptions,context_switches\n");
+    }
+    if (segmentsOut) segmentWriter.text("algorithm,pid,start,end,core\n");
+
+    FILE* chromeOut = nullptr;
+    FILE* perfettoOut = nullptr;
+    if (!options.chromeTracePath.empty() && !(chromeOut = openOutputFile(options.chromeTracePath))) {
+        return EXIT_BATCH_OUTPUT;
+    }
+    if (!options.perfettoPath.empty() && !(perfettoOut = openOutputFile(options.perfettoPath))) {
+        return EXIT_BATCH_OUTPUT;
+    }
+    BufferedWriter chromeWriter(chromeOut ? chromeOut : stdout);
+    BufferedWriter perfettoWriter(perfettoOut ? perfettoOut : stdout);
+    ChromeTraceWriter chrome(chromeWriter);
+    PerfettoTraceWriter perfetto(perfettoWriter);
+
+    // Summary lines go to stderr when the results themselves are written to stdout
+    ostream& summary = options.outputPath == "-" || options.segmentsPath == "-" ||
+                       options.chromeTracePath == "-" || options.perfettoPath == "-" ? cerr : cout;
+    summary << "algorithm,processes,makespan,throughput,avg_turnaround,avg_waiting,avg_response,"
+            << "p50_turnaround,p99_turnaround,p999_turnaround,p50_waiting,p99_waiting,p999_waiting,"
+            << "p50_response,p99_response,p999_response,segments,coalesced_segments" << endl;
+    for (const auto& name : options.algorithms) {
+        // The engines record the summary statistics as processes complete
+        CompletionMetrics metrics;
+        workload.metrics = &metrics;
+
+        // Segments are only kept when they are written out. The coalescing stage always runs
+        // so both counts can be reported; with --coalesce the merged segments are written.
+        long long segments, coalescedSegments;
+        if (segmentsOut || chromeOut || perfettoOut) {
+            FileSink file(segmentWriter, name);
+            BatchSegmentOutputs outputs;
+            BusyPeriods busy;
+            if (segmentsOut) outputs.file = &file;
+            if (chromeOut || perfettoOut) outputs.busy = &busy;
+            if (chromeOut) {
+                outputs.chrome = &chrome;
+                chrome.beginProcess(name);
+            }
+            if (perfettoOut) {
+                outputs.perfetto = &perfetto;
+                perfetto.beginProcess(name);
+            }
+            CoalescingSink<BatchSegmentOutputs> sink(outputs, options.coalesce);
+            runBatchAlgorithm(name, workload, sink, options);
+            sink.flush();
+            segments = sink.received;
+            coalescedSegments = sink.coalesced;
+            if (chromeOut) writeReadyQueueCounters(chrome, workload, busy);
+            if (perfettoOut) writeReadyQueueCounters(perfetto, workload, busy);
+        } else {
+            NullSink discard;
+            CoalescingSink<NullSink> sink(discard);
+            runBatchAlgorithm(name, workload, sink, options);
+            segments = sink.received;
+            coalescedSegments = sink.coalesced;
+        }
+        workload.metrics = nullptr;
+        summary << name << ',' << workload.size() << ',' << metrics.makespan << ','
+                << fixed << setprecision(4) << metrics.throughput() << ','
+                << metrics.turnaround.mean() << ',' << metrics.waiting.mean() << ',' << metrics.response.mean();
+        const LatencyHistogram* histograms[] = {&metrics.turnaround, &metrics.waiting, &metrics.response};
+        for (const LatencyHistogram* h : histograms) {
+            summary << ',' << h->percentile(50) << ',' << h->percentile(99) << ',' << h->percentile(99.9);
+        }
+        summary << ',' << segments << ',' << coalescedSegments << endl;
+        if (out) writeResultsCSV(writer, name, workload);
+    }
+
+    if (out && !closeOutputFile(out, writer)) {
+        cerr << "error writing " << options.outputPath << endl;
+        return EXIT_BATCH_OUTPUT;
+    }
+    if (segmentsOut && !closeOutputFile(segmentsOut, segmentWriter)) {
+        cerr << "error writing " << options.segmentsPath << endl;
+        return EXIT_BATCH_OUTPUT;
+    }
+    if (chromeOut) chrome.finish();
+    if (chromeOut && !closeOutputFile(chromeOut, chromeWriter)) {
+        cerr << "error writing " << options.chromeTracePath << endl;
+        return EXIT_BATCH_OUTPUT;
+    }
+    if (perfettoOut && !closeOutputFile(perfettoOut, perfettoWriter)) {
+        cerr << "error writing " << options.perfettoPath << endl;
+        return EXIT_BATCH_OUTPUT;
+    }
+    return EXIT_BATCH_OK;
+}
+
+// Builds that embed the scheduler (the benchmark suite) define CPU_SCHEDULER_NO_MAIN
+#ifndef CPU_SCHEDULER_NO_MAIN
+int main(int argc, char* argv[]) {
+    // Any command-line argument selects the non-interactive batch mode
+    if (argc > 1) return runBatch(argc, argv);
+
     // Processes can be provided interactively or the program can use a
     // built-in default set. Interactive input expects: PID Arrival Burst Priority
     vector<Process> processes;
@@ -496,8 +4693,18 @@ int main() {
         cout << "4. Priority Scheduling" << endl;
         cout << "5. Priority Scheduling(with aging)" << endl;
         cout << "6. Exit" << endl;
+        cout << "7. Round Robin (arrival-aware)" << endl;
+        cout << "8. SRTF (Shortest Remaining Time First)" << endl;
+        cout << "9. Priority Scheduling (preemptive, with aging)" << endl;
+        cout << "10. MLFQ (Multi-Level Feedback Queue)" << endl;
+        cout << "11. CFS (Completely Fair Scheduler)" << endl;
+        cout << "12. EEVDF (Earliest Eligible Virtual Deadline First)" << endl;
+        cout << "13. Multi-core (per-core run queues)" << endl;
+        cout << "14. Multi-core with work stealing (FCFS / SJF / Priority)" << endl;
+        cout << "15. FCFS (parallel scan)" << endl;
+        cout << "16. Busy-period sharded (FCFS / SJF / Priority)" << endl;
         cout << string(80, '-') << endl;
-        cout << "Enter your choice (1-6): ";
+        cout << "Enter your choice (1-16, 6 exits): ";
         cin >> choice;
 
         if (choice == 6) break;
@@ -509,3 +4716,4 @@ int main() {
     cout << "\nThank you for using CPU Scheduler!" << endl;
     return 0;
 }
+#endif
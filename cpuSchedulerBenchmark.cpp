@@ -0,0 +1,203 @@
+// Google Benchmark suite for the Scheduler engines.
+//
+// Build: g++ -std=c++11 -O2 -pthread cpuSchedulerBenchmark.cpp -lbenchmark -o cpuSchedulerBenchmark
+//
+// Every benchmark runs one engine over a synthetic workload of `n` processes (Poisson
+// arrivals at 90% load, exponential bursts with mean 10), reports the time per process,
+// the segments produced per second and the process's peak RSS so far, and fits the
+// asymptotic complexity over n. The reference implementations (FCFS, SJF, RoundRobin,
+// PriorityScheduling) scan the whole process list per decision, so SJF and
+// PriorityScheduling stop at QUADRATIC_MAX processes; the Workload engines they map to run
+// up to 1e7 for comparison, as do the other engines. The aging engines also run with
+// LONG_AGING_INTERVAL, which should cost the same as the default interval. MultiCore and
+// BusyPeriodSharded take a vector<Process> and run like the reference implementations.
+#define CPU_SCHEDULER_NO_MAIN
+#include "cpuScheduler.cpp"
+
+#include <benchmark/benchmark.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+static const int QUADRATIC_MAX = 100000;
+static const int LINEAR_MAX = 10000000;
+// Aging interval far beyond the default 5, so an engine whose cost grows with it shows up
+static const int LONG_AGING_INTERVAL = 20000;
+
+// Same workload for every engine at a given size. Only the latest size is kept, so the
+// peak RSS reflects one workload at a time.
+static const WorkloadInput& benchmarkWorkload(int n) {
+    static WorkloadInput workload;
+    static int generated = -1;
+    if (generated != n) {
+        GeneratorConfig config;
+        config.count = n;
+        config.rate = 0.09;
+        config.seed = 42;
+        string error;
+        workload = WorkloadInput();
+        if (!WorkloadGenerator(config).generate(workload, 0, error)) {
+            cerr << error << endl;
+            exit(1);
+        }
+        generated = n;
+    }
+    return workload;
+}
+
+// Peak resident set size of the whole benchmark process so far, in MiB
+static double peakRSSMiB() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0); // Bytes
+#else
+    return usage.ru_maxrss / 1024.0; // KiB
+#endif
+#else
+    return 0;
+#endif
+}
+
+static void reportCounters(benchmark::State& state, long long segments) {
+    int n = state.range(0);
+    state.SetComplexityN(n);
+    state.counters["per_process"] = benchmark::Counter(
+        (double)state.iterations() * n, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["segments/s"] = benchmark::Counter((double)segments, benchmark::Counter::kIsRate);
+    state.counters["peak_rss_MiB"] = peakRSSMiB();
+}
+
+// Reference engines on vector<Process>. They sort or otherwise modify their input, so each
+// iteration starts from a fresh copy made outside the timed region.
+template <class Engine>
+static void runReference(benchmark::State& state, Engine engine) {
+    vector<Process> input = Workload(benchmarkWorkload(state.range(0))).toProcesses();
+    long long segments = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        vector<Process> processes = input;
+        state.ResumeTiming();
+        vector<ExecutionSegment> execution = engine(processes);
+        segments += execution.size();
+        benchmark::DoNotOptimize(execution.data());
+    }
+    reportCounters(state, segments);
+}
+
+// Workload engines, streaming into a CountingSink; they reset the per-run columns themselves
+template <class Engine>
+static void runWorkload(benchmark::State& state, Engine engine) {
+    Workload workload(benchmarkWorkload(state.range(0)));
+    long long segments = 0;
+    for (auto _ : state) {
+        CountingSink sink;
+        engine(workload, sink);
+        segments += sink.segments;
+        benchmark::DoNotOptimize(workload.completion.data());
+    }
+    reportCounters(state, segments);
+}
+
+static void BM_FCFS(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) { return Scheduler::FCFS(p); });
+}
+static void BM_SJF(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) { return Scheduler::SJF(p); });
+}
+static void BM_RoundRobin(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) { return Scheduler::RoundRobin(p, 4); });
+}
+static void BM_PriorityScheduling(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) { return Scheduler::PriorityScheduling(p, false); });
+}
+static void BM_PrioritySchedulingAging(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) { return Scheduler::PriorityScheduling(p, true); });
+}
+
+static void BM_FCFSParallel(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::FCFSParallel(w, s); });
+}
+static void BM_SJFEventDriven(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::SJFEventDriven(w, s); });
+}
+static void BM_RoundRobinEventDriven(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::RoundRobinEventDriven(w, s, 4); });
+}
+static void BM_PriorityEventDriven(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::PriorityEventDriven(w, s, false); });
+}
+static void BM_PriorityEventDrivenAging(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::PriorityEventDriven(w, s, true); });
+}
+static void BM_PriorityEventDrivenLongAging(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) {
+        Scheduler::PriorityEventDriven(w, s, true, LONG_AGING_INTERVAL);
+    });
+}
+static void BM_PriorityPreemptiveAging(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::PriorityPreemptive(w, s, true); });
+}
+static void BM_PriorityPreemptiveLongAging(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) {
+        Scheduler::PriorityPreemptive(w, s, true, LONG_AGING_INTERVAL);
+    });
+}
+static void BM_SRTF(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::SRTF(w, s); });
+}
+static void BM_MLFQ(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::MLFQ(w, s, {4, 8, 16}); });
+}
+static void BM_CFS(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::CFS(w, s); });
+}
+static void BM_EEVDF(benchmark::State& state) {
+    runWorkload(state, [](Workload& w, CountingSink& s) { Scheduler::EEVDF(w, s); });
+}
+
+// Eight cores with round-robin placement, SJF on each core
+static void BM_MultiCore(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) {
+        RoundRobinPlacement placement;
+        return Scheduler::MultiCore(p, 8, placement, [](vector<Process>& q) { return Scheduler::SJFEventDriven(q); });
+    });
+}
+static void BM_MultiCoreWorkStealing(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) {
+        RoundRobinPlacement placement;
+        return Scheduler::MultiCore(p, 8, placement, CORE_SJF, STEAL_HALF);
+    });
+}
+static void BM_BusyPeriodSharded(benchmark::State& state) {
+    runReference(state, [](vector<Process>& p) {
+        return Scheduler::BusyPeriodSharded(p, [](vector<Process>& q) { return Scheduler::SJFEventDriven(q); });
+    });
+}
+
+#define SCHEDULER_BENCHMARK(name, maxProcesses) \
+    BENCHMARK(name)->RangeMultiplier(10)->Range(100, maxProcesses)->Unit(benchmark::kMillisecond)->Complexity()
+
+SCHEDULER_BENCHMARK(BM_FCFS, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_SJF, QUADRATIC_MAX);
+SCHEDULER_BENCHMARK(BM_RoundRobin, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_PriorityScheduling, QUADRATIC_MAX);
+SCHEDULER_BENCHMARK(BM_PrioritySchedulingAging, QUADRATIC_MAX);
+SCHEDULER_BENCHMARK(BM_FCFSParallel, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_SJFEventDriven, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_RoundRobinEventDriven, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_PriorityEventDriven, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_PriorityEventDrivenAging, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_PriorityEventDrivenLongAging, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_PriorityPreemptiveAging, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_PriorityPreemptiveLongAging, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_SRTF, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_MLFQ, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_CFS, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_EEVDF, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_MultiCore, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_MultiCoreWorkStealing, LINEAR_MAX);
+SCHEDULER_BENCHMARK(BM_BusyPeriodSharded, LINEAR_MAX);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,783 @@
+// Tests of the Scheduler engines on random workloads.
+//
+// Build and run: g++ -std=c++11 -O2 -pthread cpuSchedulerTest.cpp -o cpuSchedulerTest && ./cpuSchedulerTest
+//
+// Each engine that claims to reproduce another schedule is run next to its reference (the
+// original scan it replaces, or a small simulator written for the test) and the segments
+// and per-process results must match exactly. Arrival times, bursts and priorities are
+// drawn from small ranges so ties and idle gaps come up often. Prints each mismatch and
+// exits with status 1 if there was any.
+#define CPU_SCHEDULER_NO_MAIN
+#include "cpuScheduler.cpp"
+
+static const int TRIALS = 2000;
+static const int MAX_REPORTED = 10;
+
+static int failures = 0;
+
+// Random workload with PIDs 1..n in input order and priorities in [minPriority, maxPriority]
+static vector<Process> randomProcesses(mt19937& rng, int n, int maxArrival, int maxBurst,
+                                       int minPriority = 0, int maxPriority = 0) {
+    vector<Process> processes;
+    for (int i = 0; i < n; i++) {
+        int arrival = maxArrival > 0 ? rng() % (maxArrival + 1) : 0;
+        int priority = minPriority + (int)(rng() % (maxPriority - minPriority + 1));
+        processes.push_back(Process(i + 1, arrival, 1 + rng() % maxBurst, priority));
+    }
+    return processes;
+}
+
+// Joins back-to-back segments of the same process. Engines that fast-forward a process
+// alone on the CPU emit such runs as one segment.
+static vector<ExecutionSegment> coalesce(const vector<ExecutionSegment>& execution) {
+    vector<ExecutionSegment> merged;
+    for (const auto& seg : execution) {
+        if (!merged.empty() && merged.back().processID == seg.processID && merged.back().endTime == seg.startTime &&
+            merged.back().coreID == seg.coreID) {
+            merged.back().endTime = seg.endTime;
+        } else {
+            merged.push_back(seg);
+        }
+    }
+    return merged;
+}
+
+// Per-process results implied by a single-CPU schedule: every coalesced segment is one
+// dispatch, and every segment but a process's last one ends in a preemption
+static vector<Process> resultsFromSegments(const vector<Process>& processes,
+                                           const vector<ExecutionSegment>& execution) {
+    vector<Process> results = processes;
+    unordered_map<int, Process*> byPID;
+    for (auto& p : results) {
+        p.resetRunStats();
+        byPID[p.getPID()] = &p;
+    }
+    for (const auto& seg : coalesce(execution)) {
+        Process& p = *byPID[seg.processID];
+        p.recordDispatch(seg.startTime);
+        if (p.contextSwitches > 1) p.preemptions++;
+        p.setCompletionTime(seg.endTime);
+    }
+    for (auto& p : results) {
+        p.calculateTurnaroundTime();
+        p.calculateWaitingTime();
+        p.calculateResponseTime();
+    }
+    return results;
+}
+
+// Process indices in arrival order, equal arrivals in input order
+static vector<int> arrivalOrder(const vector<Process>& processes) {
+    vector<int> order(processes.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    stable_sort(order.begin(), order.end(), [&processes](int a, int b) {
+        return processes[a].getArrivalTime() < processes[b].getArrivalTime();
+    });
+    return order;
+}
+
+static void fail(const string& test, int trial, const string& what) {
+    failures++;
+    if (failures <= MAX_REPORTED) cout << test << ", trial " << trial << ": " << what << endl;
+}
+
+// Compares the segments and the per-process results of both runs, matching rows by PID
+// since the reference scans may reorder `processes`
+static void compare(const string& test, int trial,
+                    const vector<Process>& expectedProcesses, const vector<ExecutionSegment>& expected,
+                    const vector<Process>& actualProcesses, const vector<ExecutionSegment>& actual) {
+    if (expected.size() != actual.size()) {
+        fail(test, trial, to_string(expected.size()) + " segments expected, got " + to_string(actual.size()));
+        return;
+    }
+    for (size_t k = 0; k < expected.size(); k++) {
+        const ExecutionSegment& e = expected[k];
+        const ExecutionSegment& a = actual[k];
+        if (e.processID != a.processID || e.startTime != a.startTime || e.endTime != a.endTime) {
+            fail(test, trial, "segment " + to_string(k) + ": expected P" + to_string(e.processID) + " [" +
+                              to_string(e.startTime) + ", " + to_string(e.endTime) + "), got P" +
+                              to_string(a.processID) + " [" + to_string(a.startTime) + ", " +
+                              to_string(a.endTime) + ")");
+            return;
+        }
+    }
+
+    unordered_map<int, const Process*> byPID;
+    for (const auto& p : actualProcesses) byPID[p.getPID()] = &p;
+    for (const auto& e : expectedProcesses) {
+        const Process& a = *byPID[e.getPID()];
+        if (e.completionTime != a.completionTime || e.waitingTime != a.waitingTime ||
+            e.turnaroundTime != a.turnaroundTime || e.responseTime != a.responseTime ||
+            e.preemptions != a.preemptions || e.contextSwitches != a.contextSwitches) {
+            fail(test, trial, "results of P" + to_string(e.getPID()) + " differ");
+            return;
+        }
+    }
+}
+
+// SJFEventDriven against the O(n^2) SJF scan
+static void testSJF(mt19937& rng) {
+    for (int trial = 0; trial < TRIALS; trial++) {
+        vector<Process> expected = randomProcesses(rng, 1 + rng() % 64, 80, 10);
+        vector<Process> actual = expected;
+        vector<ExecutionSegment> reference = Scheduler::SJF(expected);
+        vector<ExecutionSegment> engine = Scheduler::SJFEventDriven(actual);
+        compare("SJF", trial, expected, reference, actual, engine);
+    }
+}
+
+// PriorityEventDriven against the PriorityScheduling scan, whose aging interval is fixed at
+// 5. Negative priorities check the clamp at 0 that aging applies.
+static void testPriority(mt19937& rng, bool withAging) {
+    string test = withAging ? "Priority (aging)" : "Priority";
+    for (int trial = 0; trial < TRIALS; trial++) {
+        vector<Process> expected = randomProcesses(rng, 1 + rng() % 64, 80, 10, -3, 8);
+        vector<Process> actual = expected;
+        vector<ExecutionSegment> reference = Scheduler::PriorityScheduling(expected, withAging);
+        vector<ExecutionSegment> engine = Scheduler::PriorityEventDriven(actual, withAging);
+        compare(test, trial, expected, reference, actual, engine);
+    }
+}
+
+// Arrival-aware Round Robin one quantum at a time: a process joins the queue when it
+// arrives, and processes arriving during a slice queue ahead of the preempted one
+static vector<ExecutionSegment> simulateRoundRobin(const vector<Process>& processes, int quantum) {
+    int n = processes.size();
+    vector<int> order = arrivalOrder(processes);
+    vector<int> remaining(n);
+    for (int i = 0; i < n; i++) remaining[i] = processes[i].getBurstTime();
+    vector<ExecutionSegment> execution;
+    queue<int> ready;
+    int next = 0, time = 0, completed = 0;
+    while (completed < n) {
+        if (ready.empty()) time = max(time, processes[order[next]].getArrivalTime());
+        while (next < n && processes[order[next]].getArrivalTime() <= time) ready.push(order[next++]);
+        int i = ready.front();
+        ready.pop();
+        int run = min(quantum, remaining[i]);
+        execution.push_back(ExecutionSegment(processes[i].getPID(), time, time + run));
+        time += run;
+        remaining[i] -= run;
+        while (next < n && processes[order[next]].getArrivalTime() <= time) ready.push(order[next++]);
+        if (remaining[i] > 0) ready.push(i);
+        else completed++;
+    }
+    return coalesce(execution);
+}
+
+// RoundRobinEventDriven against the RoundRobin scan, which queues every process at time 0,
+// so everything arrives at 0. RoundRobin() sorts with std::sort, which keeps equal arrival
+// times in input order only for small inputs, so those stay at 16 processes.
+static void testRoundRobinReference(mt19937& rng) {
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int quantum = 1 + rng() % 5;
+        vector<Process> expected = randomProcesses(rng, 1 + rng() % 16, 0, 20);
+        vector<Process> actual = expected;
+        vector<ExecutionSegment> reference = coalesce(Scheduler::RoundRobin(expected, quantum));
+        vector<ExecutionSegment> engine = Scheduler::RoundRobinEventDriven(actual, quantum);
+        compare("Round Robin", trial, expected, reference, actual, engine);
+    }
+}
+
+// RoundRobinEventDriven against the quantum-by-quantum simulator on staggered arrivals, with
+// idle gaps and processes left alone on the CPU for several quanta
+static void testRoundRobinArrivals(mt19937& rng) {
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int quantum = 1 + rng() % 5;
+        vector<Process> processes = randomProcesses(rng, 1 + rng() % 48, 200, 20);
+        vector<Process> actual = processes;
+        vector<ExecutionSegment> reference = simulateRoundRobin(processes, quantum);
+        vector<ExecutionSegment> engine = coalesce(Scheduler::RoundRobinEventDriven(actual, quantum));
+        compare("Round Robin (arrivals)", trial, resultsFromSegments(processes, reference), reference, actual, engine);
+    }
+}
+
+// Preemptive SJF one time unit at a time. When the CPU is free the arrived process with the
+// least remaining time runs (ties by arrival, then input order); a waiting process takes the
+// CPU from the running one only with strictly less remaining time.
+static vector<ExecutionSegment> simulateSRTF(const vector<Process>& processes) {
+    int n = processes.size();
+    vector<int> remaining(n);
+    for (int i = 0; i < n; i++) remaining[i] = processes[i].getBurstTime();
+    auto before = [&](int a, int b) {
+        if (remaining[a] != remaining[b]) return remaining[a] < remaining[b];
+        if (processes[a].getArrivalTime() != processes[b].getArrivalTime()) {
+            return processes[a].getArrivalTime() < processes[b].getArrivalTime();
+        }
+        return a < b;
+    };
+    vector<ExecutionSegment> execution;
+    int running = -1, completed = 0;
+    for (int time = 0; completed < n; time++) {
+        int best = -1;
+        for (int i = 0; i < n; i++) {
+            if (i == running || remaining[i] == 0 || processes[i].getArrivalTime() > time) continue;
+            if (best == -1 || before(i, best)) best = i;
+        }
+        if (running == -1 || (best != -1 && remaining[best] < remaining[running])) running = best;
+        if (running == -1) continue;
+        execution.push_back(ExecutionSegment(processes[running].getPID(), time, time + 1));
+        if (--remaining[running] == 0) {
+            running = -1;
+            completed++;
+        }
+    }
+    return coalesce(execution);
+}
+
+// SRTF against the tick-by-tick simulator
+static void testSRTF(mt19937& rng) {
+    for (int trial = 0; trial < TRIALS; trial++) {
+        vector<Process> processes = randomProcesses(rng, 1 + rng() % 40, 100, 15);
+        vector<Process> actual = processes;
+        vector<ExecutionSegment> reference = simulateSRTF(processes);
+        vector<ExecutionSegment> engine = coalesce(Scheduler::SRTF(actual));
+        compare("SRTF", trial, resultsFromSegments(processes, reference), reference, actual, engine);
+    }
+}
+
+// Preemptive priority scheduling one time unit at a time. A waiting process that entered the
+// queue at `since` with priority `level` has the effective priority
+// max(0, level - (t - since) / agingInterval) with aging, or just `level` without. Arrivals
+// enter with their own priority; a preempted process re-enters with the effective priority
+// it was dispatched with, which does not age while it runs. The best waiter (ties by
+// arrival, burst, input order) takes the CPU when it is free or strictly better.
+static vector<ExecutionSegment> simulatePriorityPreemptive(const vector<Process>& processes, bool withAging,
+                                                           int agingInterval) {
+    int n = processes.size();
+    vector<int> remaining(n), level(n), since(n);
+    for (int i = 0; i < n; i++) {
+        remaining[i] = processes[i].getBurstTime();
+        level[i] = processes[i].getPriority();
+        since[i] = processes[i].getArrivalTime();
+    }
+    auto effective = [&](int i, int time) {
+        return withAging ? max(0, level[i] - (time - since[i]) / agingInterval) : level[i];
+    };
+    auto before = [&](int a, int b, int time) {
+        if (effective(a, time) != effective(b, time)) return effective(a, time) < effective(b, time);
+        if (processes[a].getArrivalTime() != processes[b].getArrivalTime()) {
+            return processes[a].getArrivalTime() < processes[b].getArrivalTime();
+        }
+        if (processes[a].getBurstTime() != processes[b].getBurstTime()) {
+            return processes[a].getBurstTime() < processes[b].getBurstTime();
+        }
+        return a < b;
+    };
+    vector<ExecutionSegment> execution;
+    int running = -1, runningLevel = 0, completed = 0;
+    for (int time = 0; completed < n; time++) {
+        int best = -1;
+        for (int i = 0; i < n; i++) {
+            if (i == running || remaining[i] == 0 || processes[i].getArrivalTime() > time) continue;
+            if (best == -1 || before(i, best, time)) best = i;
+        }
+        if (running != -1 && best != -1 && effective(best, time) < runningLevel) {
+            level[running] = runningLevel;
+            since[running] = time;
+            running = -1;
+        }
+        if (running == -1) {
+            if (best == -1) continue;
+            running = best;
+            runningLevel = effective(best, time);
+        }
+        execution.push_back(ExecutionSegment(processes[running].getPID(), time, time + 1));
+        if (--remaining[running] == 0) {
+            running = -1;
+            completed++;
+        }
+    }
+    return coalesce(execution);
+}
+
+// PriorityPreemptive against the tick-by-tick simulator, with negative priorities and
+// aging intervals from 1 to 10 plus one far longer than any run
+static void testPriorityPreemptive(mt19937& rng) {
+    const int agingIntervals[] = {1, 2, 3, 5, 7, 10, 1000};
+    for (int trial = 0; trial < TRIALS; trial++) {
+        bool withAging = trial % 8 != 0;
+        int agingInterval = agingIntervals[rng() % 7];
+        vector<Process> processes = randomProcesses(rng, 1 + rng() % 40, 100, 15, -3, 8);
+        vector<Process> actual = processes;
+        vector<ExecutionSegment> reference = simulatePriorityPreemptive(processes, withAging, agingInterval);
+        vector<ExecutionSegment> engine = coalesce(Scheduler::PriorityPreemptive(actual, withAging, agingInterval));
+        compare("Priority preemptive (aging " + (withAging ? to_string(agingInterval) : string("off")) + ")",
+                trial, resultsFromSegments(processes, reference), reference, actual, engine);
+    }
+}
+
+// MLFQ one time unit at a time. Arrivals join the tail of level 0 in arrival order. The
+// front of the highest non-empty level runs for up to its level's quantum; using all of it
+// demotes the process one level (the last level keeps it), while an arrival during the
+// slice of a process below level 0 sends it back to the tail of its own level. Arrivals at
+// the end of a slice queue ahead of the process being requeued. A boost is applied when
+// the CPU is handed out at or after the boost time: levels 1 and below move to level 0 in
+// order and the next boost is the following multiple of boostPeriod.
+static vector<ExecutionSegment> simulateMLFQ(const vector<Process>& processes, const vector<int>& levelQuanta,
+                                             int boostPeriod) {
+    int n = processes.size();
+    int levels = levelQuanta.size();
+    vector<int> order = arrivalOrder(processes);
+    vector<int> remaining(n);
+    for (int i = 0; i < n; i++) remaining[i] = processes[i].getBurstTime();
+    vector<deque<int> > queues(levels);
+    vector<ExecutionSegment> execution;
+    int nextArrival = 0, running = -1, runningLevel = 0, used = 0, completed = 0;
+    int nextBoost = boostPeriod > 0 ? boostPeriod : INT_MAX;
+    for (int time = 0; completed < n; time++) {
+        bool arrived = false;
+        while (nextArrival < n && processes[order[nextArrival]].getArrivalTime() == time) {
+            queues[0].push_back(order[nextArrival++]);
+            arrived = true;
+        }
+        if (running != -1 && used == levelQuanta[runningLevel]) {
+            queues[min(runningLevel + 1, levels - 1)].push_back(running);
+            running = -1;
+        } else if (running != -1 && arrived && runningLevel > 0) {
+            queues[runningLevel].push_back(running);
+            running = -1;
+        }
+        if (running == -1) {
+            int lv = 0;
+            while (lv < levels && queues[lv].empty()) lv++;
+            if (lv == levels) continue;
+            if (time >= nextBoost) {
+                for (int k = 1; k < levels; k++) {
+                    queues[0].insert(queues[0].end(), queues[k].begin(), queues[k].end());
+                    queues[k].clear();
+                }
+                lv = 0;
+                nextBoost = (time / boostPeriod + 1) * boostPeriod;
+            }
+            running = queues[lv].front();
+            queues[lv].pop_front();
+            runningLevel = lv;
+            used = 0;
+        }
+        execution.push_back(ExecutionSegment(processes[running].getPID(), time, time + 1));
+        used++;
+        if (--remaining[running] == 0) {
+            running = -1;
+            completed++;
+        }
+    }
+    return coalesce(execution);
+}
+
+// MLFQ against the tick-by-tick simulator with one to four levels, random quanta and boost
+// periods, including none
+static void testMLFQ(mt19937& rng) {
+    for (int trial = 0; trial < TRIALS; trial++) {
+        vector<int> levelQuanta(1 + rng() % 4);
+        for (int& quantum : levelQuanta) quantum = 1 + rng() % 6;
+        int boostPeriod = trial % 4 == 0 ? 0 : 5 + rng() % 36;
+        vector<Process> processes = randomProcesses(rng, 1 + rng() % 40, 100, 15);
+        vector<Process> actual = processes;
+        vector<ExecutionSegment> reference = simulateMLFQ(processes, levelQuanta, boostPeriod);
+        vector<ExecutionSegment> engine = coalesce(Scheduler::MLFQ(actual, levelQuanta, boostPeriod));
+        compare("MLFQ (boost " + to_string(boostPeriod) + ")", trial, resultsFromSegments(processes, reference),
+                reference, actual, engine);
+    }
+}
+
+// Checks a fair-share schedule for properties that hold whatever the slice lengths: segments
+// do not overlap, no process starts before it arrives or runs longer or shorter than its
+// burst, and the CPU is never idle while an arrived process is unfinished. The per-process
+// results must also agree with the ones implied by the segments.
+static void checkFairSchedule(const string& test, int trial, const vector<Process>& processes,
+                              const vector<Process>& actual, const vector<ExecutionSegment>& execution) {
+    vector<ExecutionSegment> merged = coalesce(execution);
+    unordered_map<int, const Process*> byPID;
+    for (const auto& p : processes) byPID[p.getPID()] = &p;
+    unordered_map<int, int> ran;
+    vector<pair<int, int> > gaps; // Idle intervals between segments
+    int previousEnd = 0;
+    for (const auto& seg : merged) {
+        const Process& p = *byPID[seg.processID];
+        if (seg.startTime < previousEnd || seg.endTime <= seg.startTime) {
+            fail(test, trial, "P" + to_string(seg.processID) + " [" + to_string(seg.startTime) + ", " +
+                              to_string(seg.endTime) + ") overlaps the previous segment or is empty");
+            return;
+        }
+        if (seg.startTime < p.getArrivalTime()) {
+            fail(test, trial, "P" + to_string(seg.processID) + " starts at " + to_string(seg.startTime) +
+                              " before arriving at " + to_string(p.getArrivalTime()));
+            return;
+        }
+        if (seg.startTime > previousEnd) gaps.push_back(make_pair(previousEnd, seg.startTime));
+        ran[seg.processID] += seg.endTime - seg.startTime;
+        previousEnd = seg.endTime;
+    }
+    vector<Process> expected = resultsFromSegments(processes, merged);
+    for (const auto& p : expected) {
+        if (ran[p.getPID()] != p.getBurstTime()) {
+            fail(test, trial, "P" + to_string(p.getPID()) + " ran " + to_string(ran[p.getPID()]) +
+                              " instead of its burst " + to_string(p.getBurstTime()));
+            return;
+        }
+        for (const auto& gap : gaps) {
+            if (gap.first < p.completionTime && gap.second > p.getArrivalTime()) {
+                fail(test, trial, "CPU idle in [" + to_string(gap.first) + ", " + to_string(gap.second) +
+                                  ") while P" + to_string(p.getPID()) + " is waiting");
+                return;
+            }
+        }
+    }
+    compare(test, trial, expected, merged, actual, coalesce(execution));
+}
+
+// CPU time each of `processes` (all arriving at 0) gets until the first one completes,
+// relative to the first process, next to the ratio of their nice weights
+static void checkShareSplit(const string& test, const vector<Process>& processes,
+                            const vector<ExecutionSegment>& execution) {
+    unordered_map<int, long long> ran;
+    for (const auto& seg : execution) {
+        ran[seg.processID] += seg.endTime - seg.startTime;
+        bool done = false;
+        for (const auto& p : processes) done = done || ran[p.getPID()] == p.getBurstTime();
+        if (done) break;
+    }
+    for (size_t i = 1; i < processes.size(); i++) {
+        double expected = (double)niceToWeight(processes[i].getPriority()) / niceToWeight(processes[0].getPriority());
+        double actual = (double)ran[processes[i].getPID()] / ran[processes[0].getPID()];
+        if (fabs(actual / expected - 1) > 0.02) {
+            fail(test, 0, "nice " + to_string(processes[i].getPriority()) + " got " + to_string(actual) +
+                          " of the CPU time of nice " + to_string(processes[0].getPriority()) + ", expected " +
+                          to_string(expected));
+        }
+    }
+}
+
+// Nice levels whose CPU shares are checked while all of them are runnable
+static const int NICE_SETS[][3] = {{0, 0, 0}, {0, 5, 10}, {-3, 0, 2}, {-20, -10, 0}, {0, 1, 19}};
+
+// CFS on random workloads with negative and positive nice values and several latency and
+// granularity settings, then the share split of long-running processes
+static void testCFS(mt19937& rng) {
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int minGranularity = 1 + rng() % 4;
+        int targetLatency = minGranularity + rng() % 30;
+        vector<Process> processes = randomProcesses(rng, 1 + rng() % 40, 100, 30, -5, 10);
+        vector<Process> actual = processes;
+        vector<ExecutionSegment> engine = Scheduler::CFS(actual, targetLatency, minGranularity);
+        checkFairSchedule("CFS", trial, processes, actual, engine);
+    }
+    for (const auto& nice : NICE_SETS) {
+        vector<Process> processes;
+        for (int i = 0; i < 3; i++) processes.push_back(Process(i + 1, 0, 100000, nice[i]));
+        checkShareSplit("CFS shares", processes, Scheduler::CFS(processes));
+    }
+}
+
+// EEVDF on random workloads with several base slices, then the share split
+static void testEEVDF(mt19937& rng) {
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int baseSlice = 1 + rng() % 8;
+        vector<Process> processes = randomProcesses(rng, 1 + rng() % 40, 100, 30, -5, 10);
+        vector<Process> actual = processes;
+        vector<ExecutionSegment> engine = Scheduler::EEVDF(actual, baseSlice);
+        checkFairSchedule("EEVDF", trial, processes, actual, engine);
+    }
+    for (const auto& nice : NICE_SETS) {
+        vector<Process> processes;
+        for (int i = 0; i < 3; i++) processes.push_back(Process(i + 1, 0, 100000, nice[i]));
+        checkShareSplit("EEVDF shares", processes, Scheduler::EEVDF(processes));
+    }
+}
+
+// Checks a multi-core schedule for what holds under any placement: segments are on a core
+// in range, do not overlap on their core and start no earlier than their process arrives,
+// and every process runs for exactly its burst (in one segment when `singleSegment`)
+static void checkMultiCoreSchedule(const string& test, int trial, const vector<Process>& processes,
+                                   const vector<ExecutionSegment>& execution, int cores, bool singleSegment) {
+    unordered_map<int, const Process*> byPID;
+    for (const auto& p : processes) byPID[p.getPID()] = &p;
+    unordered_map<int, int> ran, segments;
+    vector<vector<ExecutionSegment> > byCore(cores);
+    for (const auto& seg : execution) {
+        if (seg.coreID < 0 || seg.coreID >= cores || !byPID.count(seg.processID)) {
+            fail(test, trial, "segment of P" + to_string(seg.processID) + " on core " + to_string(seg.coreID));
+            return;
+        }
+        if (seg.startTime < byPID[seg.processID]->getArrivalTime()) {
+            fail(test, trial, "P" + to_string(seg.processID) + " starts at " + to_string(seg.startTime) +
+                              " before arriving at " + to_string(byPID[seg.processID]->getArrivalTime()));
+            return;
+        }
+        ran[seg.processID] += seg.endTime - seg.startTime;
+        segments[seg.processID]++;
+        byCore[seg.coreID].push_back(seg);
+    }
+    for (int c = 0; c < cores; c++) {
+        sort(byCore[c].begin(), byCore[c].end(), [](const ExecutionSegment& a, const ExecutionSegment& b) {
+            return a.startTime < b.startTime;
+        });
+        for (size_t k = 1; k < byCore[c].size(); k++) {
+            if (byCore[c][k].startTime < byCore[c][k - 1].endTime) {
+                fail(test, trial, "P" + to_string(byCore[c][k - 1].processID) + " and P" +
+                                  to_string(byCore[c][k].processID) + " overlap on core " + to_string(c));
+                return;
+            }
+        }
+    }
+    for (const auto& p : processes) {
+        if (ran[p.getPID()] != p.getBurstTime() || (singleSegment && segments[p.getPID()] != 1)) {
+            fail(test, trial, "P" + to_string(p.getPID()) + " ran " + to_string(ran[p.getPID()]) + " in " +
+                              to_string(segments[p.getPID()]) + " segments, burst " + to_string(p.getBurstTime()));
+            return;
+        }
+    }
+}
+
+// MultiCore with round-robin placement: core c must run the engine over the processes
+// whose position in arrival order is c mod cores
+static void testMultiCore(mt19937& rng) {
+    const string names[] = {"FCFS", "SJF", "Round Robin"};
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int cores = 1 + rng() % 6;
+        int policy = rng() % 3;
+        int quantum = 1 + rng() % 5;
+        Scheduler::CoreEngine engine = Scheduler::FCFS;
+        if (policy == 1) engine = [](vector<Process>& p) { return Scheduler::SJFEventDriven(p); };
+        if (policy == 2) engine = [quantum](vector<Process>& p) { return Scheduler::RoundRobinEventDriven(p, quantum); };
+        string test = "MultiCore " + names[policy] + " (" + to_string(cores) + " cores)";
+
+        vector<Process> processes = randomProcesses(rng, 1 + rng() % 60, 100, 15);
+        vector<Process> actual = processes;
+        RoundRobinPlacement placement;
+        vector<ExecutionSegment> execution = Scheduler::MultiCore(actual, cores, placement, engine);
+        checkMultiCoreSchedule(test, trial, processes, execution, cores, policy != 2);
+
+        vector<int> order = arrivalOrder(processes);
+        for (int c = 0; c < cores; c++) {
+            vector<Process> expected;
+            for (size_t k = c; k < order.size(); k += cores) expected.push_back(processes[order[k]]);
+            vector<ExecutionSegment> reference = engine(expected);
+            vector<ExecutionSegment> onCore;
+            for (const auto& seg : execution) {
+                if (seg.coreID == c) onCore.push_back(seg);
+            }
+            compare(test, trial, expected, reference, actual, onCore);
+        }
+    }
+}
+
+// Random workload whose arrival times are all different, drawn from [0, 3n)
+static vector<Process> distinctArrivals(mt19937& rng, int n, int maxBurst, int minPriority, int maxPriority) {
+    vector<int> times(3 * n);
+    for (size_t t = 0; t < times.size(); t++) times[t] = t;
+    shuffle(times.begin(), times.end(), rng);
+    vector<Process> processes;
+    for (int i = 0; i < n; i++) {
+        int priority = minPriority + (int)(rng() % (maxPriority - minPriority + 1));
+        processes.push_back(Process(i + 1, times[i], 1 + rng() % maxBurst, priority));
+    }
+    return processes;
+}
+
+// Work-stealing MultiCore. Without stealing and with distinct arrivals it must place and run
+// every process like the engine-based MultiCore with the matching single-core engine; with
+// stealing the schedule must stay valid on every core.
+static void testWorkStealing(mt19937& rng) {
+    const CoreQueueOrder orders[] = {CORE_FCFS, CORE_SJF, CORE_PRIORITY};
+    const Scheduler::CoreEngine engines[] = {
+        Scheduler::FCFS,
+        [](vector<Process>& p) { return Scheduler::SJFEventDriven(p); },
+        [](vector<Process>& p) { return Scheduler::PriorityEventDriven(p, false); }};
+    const StealPolicy policies[] = {STEAL_RANDOM, STEAL_HALF, STEAL_POWER_OF_TWO};
+    RoundRobinPlacement roundRobin;
+    LeastLoadedPlacement leastLoaded;
+    PidHashPlacement pidHash;
+    PlacementPolicy* placements[] = {&roundRobin, &leastLoaded, &pidHash};
+
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int cores = 1 + rng() % 6;
+        int order = rng() % 3;
+        PlacementPolicy& placement = *placements[rng() % 3];
+        string test = "Work stealing (" + to_string(cores) + " cores, order " + to_string(order) + ")";
+
+        vector<Process> processes = distinctArrivals(rng, 1 + rng() % 60, 15, -3, 8);
+        vector<Process> expected = processes;
+        vector<Process> actual = processes;
+        vector<ExecutionSegment> reference = Scheduler::MultiCore(expected, cores, placement, engines[order]);
+        vector<ExecutionSegment> execution = Scheduler::MultiCore(actual, cores, placement, orders[order], STEAL_NONE);
+        unordered_map<int, tuple<int, int, int> > expectedRuns, actualRuns; // PID -> (start, end, core)
+        for (const auto& seg : reference) expectedRuns[seg.processID] = make_tuple(seg.startTime, seg.endTime, seg.coreID);
+        for (const auto& seg : execution) actualRuns[seg.processID] = make_tuple(seg.startTime, seg.endTime, seg.coreID);
+        if (expectedRuns != actualRuns || execution.size() != processes.size()) {
+            fail(test, trial, "STEAL_NONE differs from the engine-based MultiCore");
+        }
+
+        processes = randomProcesses(rng, 1 + rng() % 60, 40, 15, -3, 8);
+        for (StealPolicy policy : policies) {
+            actual = processes;
+            WorkStealingStats stats;
+            execution = Scheduler::MultiCore(actual, cores, placement, orders[order], policy, &stats, trial + 1);
+            checkMultiCoreSchedule(test + ", policy " + to_string(policy), trial, processes, execution, cores, true);
+        }
+    }
+}
+
+// FCFSParallel on a Workload against FCFS, with distinct arrivals since FCFS's sort is not
+// stable. The large workloads give every thread count at least two blocks of 32768 rows;
+// they are shuffled so the scan goes through the arrival order it builds.
+static void testFCFSParallel(mt19937& rng) {
+    const int threadCounts[] = {1, 2, 3, 8};
+    for (int trial = 0; trial < TRIALS / 100 + 8; trial++) {
+        int n = trial < 8 ? 600000 : 1 + rng() % 200;
+        int maxBurst = trial % 2 == 0 ? 2 : 15; // Idle gaps are common with the short bursts
+        vector<Process> processes = distinctArrivals(rng, n, maxBurst, 0, 0);
+        vector<Process> expected = processes;
+        vector<ExecutionSegment> reference = Scheduler::FCFS(expected);
+        for (int threads : threadCounts) {
+            Workload workload(processes);
+            vector<ExecutionSegment> engine = Scheduler::FCFSParallel(workload, threads);
+            compare("FCFSParallel (" + to_string(threads) + " threads)", trial, expected, reference,
+                    workload.toProcesses(), engine);
+        }
+    }
+}
+
+// BusyPeriodSharded against one run of the same engine over the arrival-sorted processes.
+// Arrivals are spread thinly so the workloads have many idle gaps to shard at.
+static void testBusyPeriodSharded(mt19937& rng) {
+    const Scheduler::CoreEngine engines[] = {
+        [](vector<Process>& p) { return Scheduler::SJFEventDriven(p); },
+        [](vector<Process>& p) { return Scheduler::PriorityEventDriven(p, false); }};
+    const string names[] = {"SJF", "Priority"};
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int policy = trial % 2;
+        int threads = 1 + rng() % 8;
+        int n = 1 + rng() % 400;
+        vector<Process> processes = randomProcesses(rng, n, n * (2 + rng() % 10), 10, -3, 8);
+        vector<Process> expected = processes;
+        stable_sort(expected.begin(), expected.end(), [](const Process& a, const Process& b) {
+            return a.getArrivalTime() < b.getArrivalTime();
+        });
+        vector<ExecutionSegment> reference = engines[policy](expected);
+        vector<ExecutionSegment> sharded = Scheduler::BusyPeriodSharded(processes, engines[policy], threads);
+        compare("BusyPeriodSharded " + names[policy] + " (" + to_string(threads) + " threads)", trial, expected,
+                reference, processes, sharded);
+    }
+}
+
+static bool sameColumns(const WorkloadInput& a, const WorkloadInput& b) {
+    return a.pid == b.pid && a.arrival == b.arrival && a.burst == b.burst && a.priority == b.priority;
+}
+
+// Round trip of random columns through a CSV file and both binary trace encodings, then
+// every truncation of a small trace must be rejected. The files are written to the
+// current directory and removed afterwards.
+static void testTraceFiles(mt19937& rng) {
+    const string csvPath = "cpuSchedulerTest.tmp.csv", tracePath = "cpuSchedulerTest.tmp.trace";
+    for (int trial = 0; trial < 40; trial++) {
+        // One workload spans several of the CSV loader's 1 MB blocks
+        int n = trial == 0 ? 0 : trial == 1 ? 200000 : 1 + rng() % 1000;
+        WorkloadInput input;
+        int arrival = 0;
+        for (int i = 0; i < n; i++) {
+            arrival += rng() % 3 == 0 ? rng() % 10000 : rng() % 4;
+            input.add(1 + rng() % 1000000, arrival, rng() % 2000000, (int)(rng() % 81) - 40);
+        }
+
+        FILE* out = fopen(csvPath.c_str(), "w");
+        fprintf(out, "pid,arrival,burst,priority\n# comment\n\n");
+        for (int i = 0; i < n; i++) {
+            if (input.priority[i] == 0) fprintf(out, "%d,%d,%d\n", input.pid[i], input.arrival[i], input.burst[i]);
+            else fprintf(out, "%d,%d,%d,%d\n", input.pid[i], input.arrival[i], input.burst[i], input.priority[i]);
+        }
+        fclose(out);
+        WorkloadInput csv;
+        string error;
+        if (!loadWorkloadCSV(csvPath, csv, error) || !sameColumns(input, csv)) {
+            fail("CSV", trial, "columns differ after loading " + error);
+            continue;
+        }
+
+        for (int varint = 0; varint < 2; varint++) {
+            string test = varint ? "Varint trace" : "Fixed-width trace";
+            WorkloadInput loaded;
+            if (!saveWorkloadTrace(tracePath, csv, varint, error) || !loadWorkloadTrace(tracePath, loaded, error) ||
+                !sameColumns(input, loaded)) {
+                fail(test, trial, "columns differ after the round trip " + error);
+                continue;
+            }
+            if (n > 50) continue;
+
+            FILE* in = fopen(tracePath.c_str(), "rb");
+            vector<char> bytes;
+            char block[4096];
+            size_t got;
+            while ((got = fread(block, 1, sizeof(block), in)) > 0) bytes.insert(bytes.end(), block, block + got);
+            fclose(in);
+            for (size_t length = 0; length < bytes.size(); length++) {
+                out = fopen(tracePath.c_str(), "wb");
+                if (length) fwrite(bytes.data(), 1, length, out);
+                fclose(out);
+                WorkloadInput truncated;
+                if (loadWorkloadTrace(tracePath, truncated, error)) {
+                    fail(test, trial, "trace cut to " + to_string(length) + " of " + to_string(bytes.size()) +
+                                      " bytes was accepted");
+                }
+            }
+        }
+    }
+    remove(csvPath.c_str());
+    remove(tracePath.c_str());
+}
+
+// WorkloadGenerator must produce the same columns on one thread as on several, for every
+// arrival process and burst distribution, with counts that do not fill the last block
+static void testGenerator(mt19937& rng) {
+    const ArrivalProcess arrivals[] = {ARRIVALS_POISSON, ARRIVALS_MMPP, ARRIVALS_DIURNAL};
+    const BurstDistribution bursts[] = {BURSTS_EXPONENTIAL, BURSTS_LOGNORMAL, BURSTS_PARETO, BURSTS_BIMODAL};
+    const int threadCounts[] = {2, 3, 8};
+    for (int trial = 0; trial < 12; trial++) {
+        GeneratorConfig config;
+        config.count = trial == 0 ? 1 : WorkloadGenerator::BLOCK * (1 + rng() % 3) + rng() % 1000;
+        config.seed = rng();
+        config.arrivals = arrivals[trial % 3];
+        config.bursts = bursts[trial % 4];
+        config.period = 1000 + rng() % 100000;
+
+        WorkloadInput expected;
+        string error;
+        if (!WorkloadGenerator(config).generate(expected, 1, error)) {
+            fail("Generator", trial, error);
+            continue;
+        }
+        for (int threads : threadCounts) {
+            WorkloadInput actual;
+            if (!WorkloadGenerator(config).generate(actual, threads, error) || !sameColumns(expected, actual)) {
+                fail("Generator (" + to_string(threads) + " threads)", trial, "columns differ from one thread " + error);
+            }
+        }
+    }
+}
+
+int main() {
+    mt19937 rng(2024);
+    testSJF(rng);
+    testPriority(rng, false);
+    testPriority(rng, true);
+    testRoundRobinReference(rng);
+    testRoundRobinArrivals(rng);
+    testSRTF(rng);
+    testPriorityPreemptive(rng);
+    testMLFQ(rng);
+    testCFS(rng);
+    testEEVDF(rng);
+    testMultiCore(rng);
+    testWorkStealing(rng);
+    testFCFSParallel(rng);
+    testBusyPeriodSharded(rng);
+    testTraceFiles(rng);
+    testGenerator(rng);
+    if (failures > 0) {
+        cout << failures << " failures" << endl;
+        return 1;
+    }
+    cout << "All tests passed" << endl;
+    return 0;
+}